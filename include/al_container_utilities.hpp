@@ -46,19 +46,38 @@
 
 #include <algorithm>
 #include <array>
-#include <cmath>
+#include <bit>
+#include <compare>
+#include <concepts>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
 #include <format>
+#include <functional>
 #include <initializer_list>
 #include <iterator>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <numeric>
+#include <optional>
 #include <ranges>
 #include <span>
+#include <stdexcept>
 #include <string>
 #include <string_view>
+#include <thread>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define AUSPICIOUS_LIBRARY_X86_64_SIMD
+#include <immintrin.h>
+#endif
+
 /**
  *  @brief  All Auspicious Library's contents in this namespace.  Just do
  *          `using namespace auspicious_library` to make your life easier.
@@ -93,20 +112,89 @@ concept cu_compatible = requires {
 template<cu_compatible Container>
 using value_type = Container::value_type;
 
+/**
+ *  @brief  Get the allocator type of elements from an allocator or a memory
+ *          resource.
+ *
+ *  @tparam  T          The type of element.
+ *  @tparam  Allocator  An allocator type, or @c std::pmr::memory_resource
+ *                      pointer type.
+ */
+template<typename T, typename Allocator>
+struct rebind_allocator {
+
+    /**
+     *  @brief  The allocator rebound to allocate elements.
+     */
+    using type = std::allocator_traits<Allocator>::template rebind_alloc<T>;
+};
+
+/**
+ *  @brief  Get the allocator type of elements from a memory resource.
+ *
+ *  @tparam  T         The type of element.
+ *  @tparam  Resource  A @c std::pmr::memory_resource pointer type.
+ */
+template<typename T, typename Resource>
+requires(std::is_convertible_v<Resource, std::pmr::memory_resource *>)
+struct rebind_allocator<T, Resource> {
+
+    /**
+     *  @brief  The polymorphic allocator using the memory resource.
+     */
+    using type = std::pmr::polymorphic_allocator<T>;
+};
+
+/**
+ *  @brief  Allocator type of elements from an allocator or a memory resource.
+ *
+ *  @tparam  T          The type of element.
+ *  @tparam  Allocator  An allocator type, or @c std::pmr::memory_resource
+ *                      pointer type.
+ */
+template<typename T, typename Allocator>
+using rebind_allocator_t = rebind_allocator<T, Allocator>::type;
+
+/**
+ *  @brief  Make allocator of elements from an allocator or a memory resource.
+ *
+ *  @tparam  T          The type of element.
+ *  @tparam  Allocator  An allocator type, or @c std::pmr::memory_resource
+ *                      pointer type.
+ *  @param   allocator  An allocator, or a memory resource pointer.
+ *  @return  Allocator of elements.
+ */
+template<typename T, typename Allocator>
+[[nodiscard]] inline constexpr auto make_allocator(const Allocator &allocator)
+{
+    return rebind_allocator_t<T, Allocator>(allocator);
+}
+
 /**
  *  @brief  Many Container Utilities return this container.
+ *
  *  @tparam  Container  A compatible container type.
+ *  @tparam  Allocator  An allocator type, or @c std::pmr::memory_resource
+ *                      pointer type.
  */
-template<cu_compatible Container>
-using result_container = std::vector<value_type<Container>>;
+template<cu_compatible Container,
+    typename Allocator = std::allocator<value_type<Container>>>
+using result_container = std::vector<value_type<Container>,
+    rebind_allocator_t<value_type<Container>, Allocator>>;
 
 /**
  *  @brief  Many Container Utilities return this container if the result is
  *          nested.
+ *
  *  @tparam  Container  A compatible container type.
+ *  @tparam  Allocator  An allocator type, or @c std::pmr::memory_resource
+ *                      pointer type.
  */
-template<cu_compatible Container>
-using result_container_nested = std::vector<std::vector<value_type<Container>>>;
+template<cu_compatible Container,
+    typename Allocator = std::allocator<value_type<Container>>>
+using result_container_nested = std::vector<
+    result_container<Container, Allocator>,
+    rebind_allocator_t<result_container<Container, Allocator>, Allocator>>;
 
 /**
  *  @brief  Nested container compatible for Container Utilities.
@@ -120,6 +208,23 @@ concept cu_compatible_nested =
     cu_compatible<Container>
  && cu_compatible<value_type<Container>>;
 
+/**
+ *  @brief  Container compatible for Container Utilities' in-place
+ *          functions.
+ *
+ *  The container must satisfy @c cu_compatible and support erasing, appending
+ *  and reserving elements, such as @c std::vector and @c std::string .
+ *
+ *  @tparam  Container  The container type.
+ */
+template<typename Container>
+concept cu_compatible_resizable = cu_compatible<Container>
+    && requires(Container container, value_type<Container> value) {
+    { container.erase(container.begin(), container.end()) };
+    { container.push_back(value) };
+    { container.reserve(std::size_t()) };
+};
+
 /**
  *  @brief  A compatible container for @c boundless_access.
  *
@@ -135,10 +240,75 @@ concept boundless_accessible = cu_compatible<Container>
     { *(Container().begin()) } -> std::same_as<value_type<Container> &>;
 };
 
+namespace impl {
+
+/**
+ *  @brief  Type that can be default constructed in constant expressions.
+ *  @tparam  T  The type to check.
+ */
+template<typename T>
+concept constant_default_constructible = requires {
+    typename std::bool_constant<(static_cast<void>(T {}), true)>;
+};
+
+/**
+ *  @brief  Default constructed constant of literal type for the invalid
+ *          indices of boundless access.
+ *
+ *  It is at namespace scope rather than a static local so that valid
+ *  indices remain usable in constant expressions.
+ *
+ *  @tparam  T  The type.
+ */
+template<constant_default_constructible T>
+inline constexpr T boundless_default_constant = {};
+
+/**
+ *  @brief  Default constructed instance of non-literal type for the invalid
+ *          indices of boundless access.
+ *
+ *  A static local, so it is initialized on first use and can be read from
+ *  other static initializers.
+ *
+ *  @tparam  T  The type.
+ *  @return  The shared instance.
+ */
+template<typename T>
+[[nodiscard]] inline auto boundless_default_static() -> const T &
+{
+    static const T value = {};
+    return value;
+}
+
+/**
+ *  @brief  Get the default constructed instance of type for the invalid
+ *          indices of boundless access, shared and never modified.
+ *
+ *  @tparam  T  The type.
+ *  @return  The shared instance.
+ */
+template<typename T>
+[[nodiscard]] inline constexpr auto boundless_default() -> const T &
+{
+    if constexpr (constant_default_constructible<T>)
+    {
+        return boundless_default_constant<T>;
+    }
+    else
+    {
+        return boundless_default_static<T>();
+    }
+}
+
+} // namespace impl
+
 /**
  *  @brief  Return element at index, or a default-constructed instance of the
  *          value type if the index is invalid.
  *
+ *  Nothing is copied, the invalid indices refer to a constant instance shared
+ *  by all the containers of the value type.
+ *
  *  @tparam  Container  A compatible container type.
  *  @param   container  A container.
  *  @param   index      An index specifying element.
@@ -148,9 +318,36 @@ template<cu_compatible Container>
 [[nodiscard]] inline constexpr auto boundless_access(
     const Container &container,
     std::size_t      index
-)
+) -> const value_type<Container> &
+{
+    if (index >= container.size())
+    {
+        return impl::boundless_default<value_type<Container>>();
+    }
+    return *(container.begin() + index);
+}
+
+/**
+ *  @brief  Return copy of element at index, or a default-constructed instance
+ *          of the value type if the index is invalid.
+ *
+ *  Temporary containers are destroyed at the end of the full expression, so
+ *  the element is returned by value instead of referring into them.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @param   container  A temporary container.
+ *  @param   index      An index specifying element.
+ *  @return  Element at index or default constructed instance of type.
+ */
+template<typename Container>
+requires(cu_compatible<std::remove_cvref_t<Container>>
+      && !std::is_lvalue_reference_v<Container>)
+[[nodiscard]] inline constexpr auto boundless_access(
+    Container &&container,
+    std::size_t index
+) -> value_type<std::remove_cvref_t<Container>>
 {
-    if (index >= container.size()) return value_type<Container>();
+    if (index >= container.size()) return {};
     return *(container.begin() + index);
 }
 
@@ -369,7 +566,7 @@ struct boundless_vector : std::vector<T, Alloc> {
      *  @return  Element at index or default constructed instance.
      */
     [[nodiscard]] inline constexpr auto operator[] (std::size_t index)
-    const -> T
+    const -> const T &
     {
         return boundless_access(*this, index);
     }
@@ -393,7 +590,7 @@ struct boundless_vector : std::vector<T, Alloc> {
      *  @param  index  An index specifying element.
      *  @return  Element at index or default constructed instance.
      */
-    [[nodiscard]] inline constexpr auto at(std::size_t index) const -> T
+    [[nodiscard]] inline constexpr auto at(std::size_t index) const -> const T &
     {
         return boundless_access(*this, index);
     }
@@ -413,7 +610,7 @@ struct boundless_vector : std::vector<T, Alloc> {
      *          the value type when the vector is empty.
      *  @return  First element or default constructed instance.
      */
-    [[nodiscard]] inline constexpr auto front() const -> T
+    [[nodiscard]] inline constexpr auto front() const -> const T &
     {
         return boundless_access(*this, 0);
     }
@@ -433,7 +630,7 @@ struct boundless_vector : std::vector<T, Alloc> {
      *          the value type when the vector is empty.
      *  @return  Last element or default constructed instance.
      */
-    [[nodiscard]] inline constexpr auto back() const -> T
+    [[nodiscard]] inline constexpr auto back() const -> const T &
     {
         return boundless_access(*this, this->size() - 1);
     }
@@ -489,7 +686,7 @@ struct boundless_array : std::array<T, N> {
      *  @return  Element at index or default constructed instance.
      */
     [[nodiscard]] inline constexpr auto operator[] (std::size_t index)
-    const -> T
+    const -> const T &
     {
         return boundless_access(*this, index);
     }
@@ -513,7 +710,7 @@ struct boundless_array : std::array<T, N> {
      *  @param  index  An index specifying element.
      *  @return  Element at index or default constructed instance.
      */
-    [[nodiscard]] inline constexpr auto at(std::size_t index) const -> T
+    [[nodiscard]] inline constexpr auto at(std::size_t index) const -> const T &
     {
         return boundless_access(*this, index);
     }
@@ -533,7 +730,7 @@ struct boundless_array : std::array<T, N> {
      *          the value type when the array is empty.
      *  @return  First element or default constructed instance.
      */
-    [[nodiscard]] inline constexpr auto front() const -> T
+    [[nodiscard]] inline constexpr auto front() const -> const T &
     {
         return boundless_access(*this, 0);
     }
@@ -553,7 +750,7 @@ struct boundless_array : std::array<T, N> {
      *          the value type when the array is empty.
      *  @return  Last element or default constructed instance.
      */
-    [[nodiscard]] inline constexpr auto back() const -> T
+    [[nodiscard]] inline constexpr auto back() const -> const T &
     {
         return boundless_access(*this, this->size() - 1);
     }
@@ -594,7 +791,7 @@ struct boundless_span : std::span<T, Extent> {
      *  @return  Element at index or default constructed instance.
      */
     [[nodiscard]] inline constexpr auto operator[] (std::size_t index)
-    const -> T
+    const -> const T &
     {
         return boundless_access(*this, index);
     }
@@ -606,7 +803,7 @@ struct boundless_span : std::span<T, Extent> {
      *  @param  index  An index specifying element.
      *  @return  Element at index or default constructed instance.
      */
-    [[nodiscard]] inline constexpr auto at(std::size_t index) const -> T
+    [[nodiscard]] inline constexpr auto at(std::size_t index) const -> const T &
     {
         return boundless_access(*this, index);
     }
@@ -616,7 +813,7 @@ struct boundless_span : std::span<T, Extent> {
      *          the value type when the span is empty.
      *  @return  First element or default constructed instance.
      */
-    [[nodiscard]] inline constexpr auto front() const -> T
+    [[nodiscard]] inline constexpr auto front() const -> const T &
     {
         return boundless_access(*this, 0);
     }
@@ -626,7 +823,7 @@ struct boundless_span : std::span<T, Extent> {
      *          the value type when the span is empty.
      *  @return  Last element or default constructed instance.
      */
-    [[nodiscard]] inline constexpr auto back() const -> T
+    [[nodiscard]] inline constexpr auto back() const -> const T &
     {
         return boundless_access(*this, this->size() - 1);
     }
@@ -1001,7 +1198,7 @@ struct boundless_basic_string : std::basic_string<CharT, Traits, Alloc> {
      */
     [[nodiscard]] inline constexpr auto operator[] (
         std::size_t index
-    ) const -> CharT
+    ) const -> const CharT &
     {
         return boundless_access(*this, index);
     }
@@ -1027,7 +1224,7 @@ struct boundless_basic_string : std::basic_string<CharT, Traits, Alloc> {
      *  @return  Character at index or default constructed instance.
      */
     [[nodiscard]] inline constexpr auto at(std::size_t index)
-    const -> CharT
+    const -> const CharT &
     {
         return boundless_access(*this, index);
     }
@@ -1047,7 +1244,7 @@ struct boundless_basic_string : std::basic_string<CharT, Traits, Alloc> {
      *          the character type when the string is empty.
      *  @return  First character or default constructed instance.
      */
-    [[nodiscard]] inline constexpr auto front() const -> CharT
+    [[nodiscard]] inline constexpr auto front() const -> const CharT &
     {
         return boundless_access(*this, 0);
     }
@@ -1067,7 +1264,7 @@ struct boundless_basic_string : std::basic_string<CharT, Traits, Alloc> {
      *          the character type when the string is empty.
      *  @return  Last character or default constructed instance.
      */
-    [[nodiscard]] inline constexpr auto back() const -> CharT
+    [[nodiscard]] inline constexpr auto back() const -> const CharT &
     {
         return boundless_access(*this, this->size() - 1);
     }
@@ -1165,7 +1362,7 @@ struct boundless_basic_string_view : std::basic_string_view<CharT, Traits> {
      */
     [[nodiscard]] inline constexpr auto operator[] (
         std::size_t index
-    ) const -> CharT
+    ) const -> const CharT &
     {
         return boundless_access(*this, index);
     }
@@ -1178,7 +1375,7 @@ struct boundless_basic_string_view : std::basic_string_view<CharT, Traits> {
      *  @return  Character at index or default constructed instance.
      */
     [[nodiscard]] inline constexpr auto at(std::size_t index)
-    const -> CharT
+    const -> const CharT &
     {
         return boundless_access(*this, index);
     }
@@ -1188,7 +1385,7 @@ struct boundless_basic_string_view : std::basic_string_view<CharT, Traits> {
      *          the character type when the string view is empty.
      *  @return  First character or default constructed instance.
      */
-    [[nodiscard]] inline constexpr auto front() const -> CharT
+    [[nodiscard]] inline constexpr auto front() const -> const CharT &
     {
         return boundless_access(*this, 0);
     }
@@ -1198,7 +1395,7 @@ struct boundless_basic_string_view : std::basic_string_view<CharT, Traits> {
      *          the character type when the string view is empty.
      *  @return  Last character or default constructed instance.
      */
-    [[nodiscard]] inline constexpr auto back() const -> CharT
+    [[nodiscard]] inline constexpr auto back() const -> const CharT &
     {
         return boundless_access(*this, this->size() - 1);
     }
@@ -1245,536 +1442,8803 @@ using boundless_u16string_view = boundless_basic_string_view<char16_t>;
 using boundless_u32string_view = boundless_basic_string_view<char32_t>;
 
 /**
- *  @brief  Container Utilities compatible enumerator for @c enumerated_array .
+ *  @brief  A boundless double-ended circular buffer.
  *
- *  The type must be an enumerator with a @c max as a member.  The @c max member
- *  must be the largest member in the enumerator (Implementation pending).
+ *  Pushing and popping at either end is O(1), the elements wrap around the
+ *  end of the buffer and can be accessed as up to two contiguous segments.
+ *  Index-access always returns a default constructed element when an invalid
+ *  index is provided, and popping an empty ring does nothing.  Requires a
+ *  default-constructible type.
  *
- *  @tparam  E  Enumerator type.
+ *  A fixed size buffer, such as @c std::array , makes a sliding window where
+ *  pushing to a full ring overwrites the element at the other end.  A
+ *  resizable buffer, such as @c std::vector , doubles its capacity instead.
+ *  Use @c boundless_ring or @c boundless_deque rather than this directly.
  *
- *  @todo  After reflection support is introduced, iterate over all the members
- *         and determine that the @c max member is the largest member.
+ *  @tparam  T       The type of element.
+ *  @tparam  Buffer  The buffer of elements.
  */
-template<typename E>
-concept cu_compatible_enum = std::is_enum_v<E> && requires { { E::max }; };
+template<typename T, typename Buffer>
+requires(std::is_default_constructible_v<T>)
+struct basic_boundless_ring {
 
-/**
- *  @brief  Integral constant for the enumerator's @c max member.
- *  @tparam  E  Container Utilities compatible enumerator type.
- */
-template<cu_compatible_enum E>
-struct enum_max : std::integral_constant<std::underlying_type_t<E>,
-        std::to_underlying (E::max)> {};
+    /**
+     *  @brief  Type of element.
+     */
+    using value_type = T;
 
-/**
- *  @brief  Helper to get the value of the enumerator's @c max member.
- *  @tparam  E  Container Utilities compatible enumerator type.
- */
-template<cu_compatible_enum E>
-inline constexpr auto enum_max_v = enum_max<E>::value;
+    /**
+     *  @brief  True if the buffer grows when the ring is full.
+     */
+    static constexpr bool growable = requires(Buffer buffer) {
+        buffer.resize(std::size_t());
+    };
 
-/**
- *  @brief  Array with enumerator as index.
- *
- *  @tparam  T  The type of element.
- *  @tparam  E  A Container Utilities compatible enumerator type.
- */
-template<typename T, cu_compatible_enum E>
-struct enumerated_array : std::array<T, enum_max_v<E>> {
+    /**
+     *  @brief  The buffer of elements, unused slots are default constructed.
+     */
+    Buffer buffer = {};
 
     /**
-     *  @brief  Base class, template arguments are long.
+     *  @brief  Index of the first element in the buffer.
      */
-    using base = std::array<T, enum_max_v<E>>;
+    std::size_t head = 0;
 
     /**
-     *  @brief  Get the element at enumerator.
+     *  @brief  The number of elements.
+     */
+    std::size_t count = 0;
+
+    /**
+     *  @brief  Random access iterator over the elements, in order.
+     *  @tparam  Const  True to iterate over constant elements.
+     */
+    template<bool Const>
+    struct basic_iterator {
+
+        /**
+         *  @brief  Iterator concept.
+         */
+        using iterator_concept = std::random_access_iterator_tag;
+
+        /**
+         *  @brief  Iterator category.
+         */
+        using iterator_category = std::random_access_iterator_tag;
+
+        /**
+         *  @brief  Iterator value type.
+         */
+        using value_type = T;
+
+        /**
+         *  @brief  Iterator difference type.
+         */
+        using difference_type = std::ptrdiff_t;
+
+        /**
+         *  @brief  Iterator reference type.
+         */
+        using reference = std::conditional_t<Const, const T &, T &>;
+
+        /**
+         *  @brief  The ring this iterator belongs to.
+         */
+        std::conditional_t<Const, const basic_boundless_ring,
+            basic_boundless_ring> *parent = nullptr;
+
+        /**
+         *  @brief  Index of the current element.
+         */
+        std::size_t index = 0;
+
+        /**
+         *  @brief  Convert to a constant iterator.
+         *  @return  Constant iterator at the same element.
+         */
+        inline constexpr operator basic_iterator<true> () const
+        requires(!Const)
+        {
+            return { parent, index };
+        }
+
+        /**
+         *  @brief  Get the current element.
+         *  @return  Current element.
+         */
+        [[nodiscard]] inline constexpr auto operator* () const -> reference
+        {
+            return parent->buffer[parent->physical(index)];
+        }
+
+        /**
+         *  @brief  Get the element relative to current element.
+         *
+         *  @param  n  The distance to the element.
+         *  @return  The element.
+         */
+        [[nodiscard]] inline constexpr auto operator[] (
+            difference_type n
+        ) const -> reference
+        {
+            return parent->buffer[parent->physical(index + n)];
+        }
+
+        /**
+         *  @brief  Advance to the next element.
+         *  @return  Reference to self.
+         */
+        inline constexpr auto operator++ () -> basic_iterator &
+        {
+            index++;
+            return *this;
+        }
+
+        /**
+         *  @brief  Advance to the next element.
+         *  @return  Copy of self before advancing.
+         */
+        inline constexpr auto operator++ (int) -> basic_iterator
+        {
+            auto copy = *this;
+            index++;
+            return copy;
+        }
+
+        /**
+         *  @brief  Go back to the previous element.
+         *  @return  Reference to self.
+         */
+        inline constexpr auto operator-- () -> basic_iterator &
+        {
+            index--;
+            return *this;
+        }
+
+        /**
+         *  @brief  Go back to the previous element.
+         *  @return  Copy of self before going back.
+         */
+        inline constexpr auto operator-- (int) -> basic_iterator
+        {
+            auto copy = *this;
+            index--;
+            return copy;
+        }
+
+        /**
+         *  @brief  Advance by @c n elements.
+         *
+         *  @param  n  The number of elements.
+         *  @return  Reference to self.
+         */
+        inline constexpr auto operator+= (difference_type n) -> basic_iterator &
+        {
+            index += n;
+            return *this;
+        }
+
+        /**
+         *  @brief  Go back by @c n elements.
+         *
+         *  @param  n  The number of elements.
+         *  @return  Reference to self.
+         */
+        inline constexpr auto operator-= (difference_type n) -> basic_iterator &
+        {
+            index -= n;
+            return *this;
+        }
+
+        /**
+         *  @brief  Get the iterator advanced by @c n elements.
+         *
+         *  @param  it  An iterator.
+         *  @param  n   The number of elements.
+         *  @return  Advanced iterator.
+         */
+        [[nodiscard]] friend inline constexpr auto operator+ (
+            basic_iterator  it,
+            difference_type n
+        ) -> basic_iterator
+        {
+            return it += n;
+        }
+
+        /**
+         *  @brief  Get the iterator advanced by @c n elements.
+         *
+         *  @param  n   The number of elements.
+         *  @param  it  An iterator.
+         *  @return  Advanced iterator.
+         */
+        [[nodiscard]] friend inline constexpr auto operator+ (
+            difference_type n,
+            basic_iterator  it
+        ) -> basic_iterator
+        {
+            return it += n;
+        }
+
+        /**
+         *  @brief  Get the iterator gone back by @c n elements.
+         *
+         *  @param  it  An iterator.
+         *  @param  n   The number of elements.
+         *  @return  Gone back iterator.
+         */
+        [[nodiscard]] friend inline constexpr auto operator- (
+            basic_iterator  it,
+            difference_type n
+        ) -> basic_iterator
+        {
+            return it -= n;
+        }
+
+        /**
+         *  @brief  Get the distance between two iterators.
+         *
+         *  @param  a  The first iterator.
+         *  @param  b  The second iterator.
+         *  @return  The number of elements from @c b to @c a .
+         */
+        [[nodiscard]] friend inline constexpr auto operator- (
+            const basic_iterator &a,
+            const basic_iterator &b
+        ) -> difference_type
+        {
+            return (difference_type)a.index - (difference_type)b.index;
+        }
+
+        /**
+         *  @brief  Compare two iterators.
+         *
+         *  @param  a  The first iterator.
+         *  @param  b  The second iterator.
+         *  @return  True if both are at the same element.
+         */
+        [[nodiscard]] friend inline constexpr auto operator== (
+            const basic_iterator &a,
+            const basic_iterator &b
+        ) -> bool
+        {
+            return a.index == b.index;
+        }
+
+        /**
+         *  @brief  Order two iterators.
+         *
+         *  @param  a  The first iterator.
+         *  @param  b  The second iterator.
+         *  @return  Ordering of the elements of both.
+         */
+        [[nodiscard]] friend inline constexpr auto operator<=> (
+            const basic_iterator &a,
+            const basic_iterator &b
+        )
+        {
+            return a.index <=> b.index;
+        }
+    };
+
+    /**
+     *  @brief  Iterator over the elements.
+     */
+    using iterator = basic_iterator<false>;
+
+    /**
+     *  @brief  Iterator over the constant elements.
+     */
+    using const_iterator = basic_iterator<true>;
+
+    /**
+     *  @brief  Creates an empty ring.
+     */
+    inline constexpr basic_boundless_ring() = default;
+
+    /**
+     *  @brief  Creates an empty ring with allocator.
      *
-     *  @param  enumerator  Enumerator specifying index.
-     *  @return  Element at index.
+     *  @tparam  Allocator  The allocator type.
+     *  @param   allocator  The allocator.
      */
-    [[nodiscard]] inline constexpr auto operator[] (E e) -> T &
+    template<typename Allocator>
+    requires(growable && std::is_constructible_v<Buffer, const Allocator &>)
+    explicit inline constexpr basic_boundless_ring(const Allocator &allocator)
+        : buffer(allocator) {}
+
+    /**
+     *  @brief  Creates a ring from initializer list.
+     *  @param  list  The initializer list.
+     */
+    inline constexpr basic_boundless_ring(std::initializer_list<T> list)
     {
-        return base::operator[] (std::to_underlying(e));
+        append_range(list);
     }
 
     /**
-     *  @brief  Get the element at enumerator.
-     *
-     *  @param  enumerator  Enumerator specifying index.
-     *  @return  Element at index.
+     *  @brief  Get the number of elements.
+     *  @return  The number of elements.
      */
-    [[nodiscard]] inline constexpr auto operator[] (E e) const -> T
+    [[nodiscard]] inline constexpr auto size() const
     {
-        return base::operator[] (std::to_underlying(e));
+        return count;
     }
 
     /**
-     *  @brief  Get the element at enumerator.
+     *  @brief  Get the number of elements the buffer can hold.
+     *  @return  The number of elements the buffer can hold.
+     */
+    [[nodiscard]] inline constexpr auto capacity() const
+    {
+        return (std::size_t)std::ranges::size(buffer);
+    }
+
+    /**
+     *  @brief  Check if there are no elements.
+     *  @return  True if there are no elements.
+     */
+    [[nodiscard]] inline constexpr auto empty() const
+    {
+        return count == 0;
+    }
+
+    /**
+     *  @brief  Check if the buffer is full.
+     *  @return  True if the next push overwrites or grows.
+     */
+    [[nodiscard]] inline constexpr auto full() const
+    {
+        return count == capacity();
+    }
+
+    /**
+     *  @brief  Get the buffer index of an element.
      *
-     *  @param  enumerator  Enumerator specifying index.
-     *  @return  Element at index.
+     *  @param  index  The index of the element, less than the capacity.
+     *  @return  The buffer index of the element.
      */
-    [[nodiscard]] inline constexpr auto at(E e) -> T &
+    [[nodiscard]] inline constexpr auto physical(std::size_t index) const
     {
-        return base::at(std::to_underlying(e));
+        // Both are less than capacity, one subtraction wraps it around
+        auto position = head + index;
+        return position >= capacity() ? position - capacity() : position;
     }
 
     /**
-     *  @brief  Get the element at enumerator.
+     *  @brief  Grow the buffer to hold at least @c size elements.
      *
-     *  @param  enumerator  Enumerator specifying index.
-     *  @return  Element at index.
+     *  The elements are moved to the start of the new buffer.
+     *
+     *  @param  size  The number of elements.
      */
-    [[nodiscard]] inline constexpr auto at(E e) const -> T
+    inline constexpr auto reserve(std::size_t size) -> void requires(growable)
     {
-        return base::at(std::to_underlying(e));
+        if (size <= capacity()) return;
+
+        Buffer grown(size, buffer.get_allocator());
+        for (std::size_t i = 0; i < count; i++)
+        {
+            grown[i] = std::move(buffer[physical(i)]);
+        }
+
+        buffer = std::move(grown);
+        head   = 0;
     }
-};
 
+    /**
+     *  @brief  Remove all the elements.
+     */
+    inline constexpr auto clear() -> void
+    {
+        std::ranges::fill(buffer, T());
+        head  = 0;
+        count = 0;
+    }
 
+    /**
+     *  @brief  Get the element at index, or a default constructed instance of
+     *          the element type when the index is invalid.
+     *
+     *  @param  index  The index of the element.
+     *  @return  Element or default constructed instance.
+     */
+    [[nodiscard]] inline constexpr auto at(std::size_t index) -> T &
+    {
+        static T value;
 
-/**
- *  @brief  Get the subset of the container's elements.
- *
- *  @tparam  Container        A compatible container type.
- *  @param   container        A container.
- *  @param   first_inclusive  The first index (inclusive).
- *  @param   last_exclusive   The last index (exclusive).
- *  @return  Subset of the container as @c result_container .
- */
-template<cu_compatible Container>
-[[nodiscard]] inline constexpr auto subordinate(
-    const Container &container,
-    std::size_t      first_inclusive,
-    std::size_t      last_exclusive
-)
-{
-    return result_container<Container>(
-        container.begin() + first_inclusive,
-        container.begin() + last_exclusive);
-}
+        // Always initialize to default every time it is accessed
+        value = {};
+        if (index >= count) return value;
+        return buffer[physical(index)];
+    }
 
-/**
+    /**
+     *  @brief  Get the element at index, or a default constructed instance of
+     *          the element type when the index is invalid.
+     *
+     *  @param  index  The index of the element.
+     *  @return  Element or default constructed instance.
+     */
+    [[nodiscard]] inline constexpr auto at(std::size_t index) const
+    -> const T &
+    {
+        if (index >= count) return impl::boundless_default<T>();
+        return buffer[physical(index)];
+    }
+
+    /**
+     *  @brief  Get the element at index, or a default constructed instance of
+     *          the element type when the index is invalid.
+     *
+     *  @param  index  The index of the element.
+     *  @return  Element or default constructed instance.
+     */
+    [[nodiscard]] inline constexpr auto operator[] (std::size_t index) -> T &
+    {
+        return at(index);
+    }
+
+    /**
+     *  @brief  Get the element at index, or a default constructed instance of
+     *          the element type when the index is invalid.
+     *
+     *  @param  index  The index of the element.
+     *  @return  Element or default constructed instance.
+     */
+    [[nodiscard]] inline constexpr auto operator[] (std::size_t index) const
+    -> const T &
+    {
+        return at(index);
+    }
+
+    /**
+     *  @brief  Get the first element, or a default constructed instance of
+     *          the element type when the ring is empty.
+     *  @return  First element or default constructed instance.
+     */
+    [[nodiscard]] inline constexpr auto front() -> T &
+    {
+        return at(0);
+    }
+
+    /**
+     *  @brief  Get the first element, or a default constructed instance of
+     *          the element type when the ring is empty.
+     *  @return  First element or default constructed instance.
+     */
+    [[nodiscard]] inline constexpr auto front() const -> const T &
+    {
+        return at(0);
+    }
+
+    /**
+     *  @brief  Get the last element, or a default constructed instance of
+     *          the element type when the ring is empty.
+     *  @return  Last element or default constructed instance.
+     */
+    [[nodiscard]] inline constexpr auto back() -> T &
+    {
+        return at(count - 1);
+    }
+
+    /**
+     *  @brief  Get the last element, or a default constructed instance of
+     *          the element type when the ring is empty.
+     *  @return  Last element or default constructed instance.
+     */
+    [[nodiscard]] inline constexpr auto back() const -> const T &
+    {
+        return at(count - 1);
+    }
+
+    /**
+     *  @brief  Construct an element at the end.
+     *
+     *  A full fixed size ring overwrites its first element.
+     *
+     *  @tparam  Args  The types of arguments.
+     *  @param   args  The arguments to construct the element with.
+     *  @return  The new element.
+     */
+    template<typename... Args>
+    inline constexpr auto emplace_back(Args &&...args) -> T &
+    {
+        // Arguments may refer to an element that is about to move
+        T value(std::forward<Args>(args)...);
+
+        if (full())
+        {
+            if constexpr (growable)
+            {
+                reserve(std::max(capacity() * 2, (std::size_t)1));
+            }
+            else
+            {
+                auto &slot = buffer[head];
+                slot = std::move(value);
+                head = physical(1);
+                return slot;
+            }
+        }
+
+        auto &slot = buffer[physical(count)];
+        slot = std::move(value);
+        count++;
+        return slot;
+    }
+
+    /**
+     *  @brief  Construct an element at the start.
+     *
+     *  A full fixed size ring overwrites its last element.
+     *
+     *  @tparam  Args  The types of arguments.
+     *  @param   args  The arguments to construct the element with.
+     *  @return  The new element.
+     */
+    template<typename... Args>
+    inline constexpr auto emplace_front(Args &&...args) -> T &
+    {
+        // Arguments may refer to an element that is about to move
+        T value(std::forward<Args>(args)...);
+
+        if constexpr (growable)
+        {
+            if (full()) reserve(std::max(capacity() * 2, (std::size_t)1));
+        }
+
+        // Slot before the first element is the last element when full
+        head = head == 0 ? capacity() - 1 : head - 1;
+        if (count < capacity()) count++;
+
+        auto &slot = buffer[head];
+        slot = std::move(value);
+        return slot;
+    }
+
+    /**
+     *  @brief  Add an element at the end.
+     *  @param  value  The element.
+     */
+    inline constexpr auto push_back(const T &value) -> void
+    {
+        emplace_back(value);
+    }
+
+    /**
+     *  @brief  Add an element at the end.
+     *  @param  value  The element.
+     */
+    inline constexpr auto push_back(T &&value) -> void
+    {
+        emplace_back(std::move(value));
+    }
+
+    /**
+     *  @brief  Add an element at the start.
+     *  @param  value  The element.
+     */
+    inline constexpr auto push_front(const T &value) -> void
+    {
+        emplace_front(value);
+    }
+
+    /**
+     *  @brief  Add an element at the start.
+     *  @param  value  The element.
+     */
+    inline constexpr auto push_front(T &&value) -> void
+    {
+        emplace_front(std::move(value));
+    }
+
+    /**
+     *  @brief  Add all the elements of a range at the end.
+     *
+     *  Sized random access ranges are copied in at most two contiguous blocks.
+     *  A fixed size ring keeps only the last elements that fit.
+     *
+     *  @tparam  Range  The range type.
+     *  @param   range  The range of elements.
+     */
+    template<std::ranges::input_range Range>
+    inline constexpr auto append_range(Range &&range) -> void
+    {
+        if constexpr (std::ranges::sized_range<Range>
+                   && std::ranges::random_access_range<Range>)
+        {
+            auto        first = std::ranges::begin(range);
+            std::size_t size  = std::ranges::size(range);
+
+            if constexpr (growable)
+            {
+                if (count + size > capacity())
+                {
+                    reserve(std::max(capacity() * 2, count + size));
+                }
+            }
+            else if (size > capacity())
+            {
+                first += size - capacity();
+                size   = capacity();
+            }
+            if (size == 0) return;
+
+            auto position = physical(count % capacity());
+            auto before   = std::min(size, capacity() - position);
+            std::ranges::copy_n(first, before,
+                std::ranges::begin(buffer) + position);
+            std::ranges::copy_n(first + before, size - before,
+                std::ranges::begin(buffer));
+
+            // Overwritten elements are dropped from the start
+            auto total = count + size;
+            if (total > capacity())
+            {
+                head  = physical(total - capacity());
+                count = capacity();
+            }
+            else count = total;
+        }
+        else
+        {
+            for (auto &&element : range)
+            {
+                emplace_back(std::forward<decltype(element)>(element));
+            }
+        }
+    }
+
+    /**
+     *  @brief  Remove the last element, if any.
+     */
+    inline constexpr auto pop_back() -> void
+    {
+        pop_back(1);
+    }
+
+    /**
+     *  @brief  Remove up to @c n elements from the end.
+     *  @param  n  The number of elements.
+     */
+    inline constexpr auto pop_back(std::size_t n) -> void
+    {
+        n = std::min(n, count);
+        for (std::size_t i = 0; i < n; i++)
+        {
+            // Release resources held by removed elements
+            buffer[physical(--count)] = T();
+        }
+    }
+
+    /**
+     *  @brief  Remove the first element, if any.
+     */
+    inline constexpr auto pop_front() -> void
+    {
+        pop_front(1);
+    }
+
+    /**
+     *  @brief  Remove up to @c n elements from the start.
+     *  @param  n  The number of elements.
+     */
+    inline constexpr auto pop_front(std::size_t n) -> void
+    {
+        n = std::min(n, count);
+        for (std::size_t i = 0; i < n; i++)
+        {
+            // Release resources held by removed elements
+            buffer[head] = T();
+            head = physical(1);
+            count--;
+        }
+    }
+
+    /**
+     *  @brief  Get the elements as two contiguous segments.
+     *
+     *  The elements are the first segment followed by the second segment, the
+     *  second segment is empty unless the elements wrap around.
+     *
+     *  @return  Pair of the segments.
+     */
+    [[nodiscard]] inline constexpr auto segments()
+    -> std::pair<std::span<T>, std::span<T>>
+    {
+        auto data   = std::ranges::data(buffer);
+        auto before = std::min(count, capacity() - head);
+        return { std::span<T>(data + head, before),
+                 std::span<T>(data, count - before) };
+    }
+
+    /**
+     *  @brief  Get the elements as two contiguous segments.
+     *
+     *  The elements are the first segment followed by the second segment, the
+     *  second segment is empty unless the elements wrap around.
+     *
+     *  @return  Pair of the segments.
+     */
+    [[nodiscard]] inline constexpr auto segments() const
+    -> std::pair<std::span<const T>, std::span<const T>>
+    {
+        auto data   = std::ranges::data(buffer);
+        auto before = std::min(count, capacity() - head);
+        return { std::span<const T>(data + head, before),
+                 std::span<const T>(data, count - before) };
+    }
+
+    /**
+     *  @brief  Rotate the buffer so that the elements are contiguous.
+     *  @return  Span of the elements.
+     */
+    inline constexpr auto linearize() -> std::span<T>
+    {
+        std::ranges::rotate(buffer, std::ranges::begin(buffer) + head);
+        head = 0;
+        return std::span<T>(std::ranges::data(buffer), count);
+    }
+
+    /**
+     *  @brief  Get the iterator to the first element.
+     *  @return  Iterator to the first element.
+     */
+    [[nodiscard]] inline constexpr auto begin() -> iterator
+    {
+        return { this, 0 };
+    }
+
+    /**
+     *  @brief  Get the iterator to the first element.
+     *  @return  Iterator to the first element.
+     */
+    [[nodiscard]] inline constexpr auto begin() const -> const_iterator
+    {
+        return { this, 0 };
+    }
+
+    /**
+     *  @brief  Get the iterator past the last element.
+     *  @return  Iterator past the last element.
+     */
+    [[nodiscard]] inline constexpr auto end() -> iterator
+    {
+        return { this, count };
+    }
+
+    /**
+     *  @brief  Get the iterator past the last element.
+     *  @return  Iterator past the last element.
+     */
+    [[nodiscard]] inline constexpr auto end() const -> const_iterator
+    {
+        return { this, count };
+    }
+
+    /**
+     *  @brief  Compare the elements of two rings.
+     *
+     *  @param  a  The first ring.
+     *  @param  b  The second ring.
+     *  @return  True if both have equal elements.
+     */
+    [[nodiscard]] friend inline constexpr auto operator== (
+        const basic_boundless_ring &a,
+        const basic_boundless_ring &b
+    ) -> bool
+    {
+        return std::ranges::equal(a, b);
+    }
+};
+
+/**
+ *  @brief  A boundless ring of fixed capacity, pushing to a full ring
+ *          overwrites the element at the other end.
+ *
+ *  @tparam  T  The type of element.
+ *  @tparam  N  The capacity.
+ */
+template<typename T, std::size_t N>
+requires(N > 0)
+using boundless_ring = basic_boundless_ring<T, std::array<T, N>>;
+
+/**
+ *  @brief  A boundless double-ended queue, growing when full.
+ *
+ *  @tparam  T      The type of element.
+ *  @tparam  Alloc  Allocator type, defaults to @c std::allocator<T> .
+ */
+template<typename T, typename Alloc = std::allocator<T>>
+using boundless_deque = basic_boundless_ring<T, std::vector<T, Alloc>>;
+
+/**
+ *  @brief  Container Utilities compatible enumerator for @c enumerated_array .
+ *
+ *  The type must be an enumerator with a @c max as a member.  The @c max member
+ *  must be the largest member in the enumerator (Implementation pending).
+ *
+ *  @tparam  E  Enumerator type.
+ *
+ *  @todo  After reflection support is introduced, iterate over all the members
+ *         and determine that the @c max member is the largest member.
+ */
+template<typename E>
+concept cu_compatible_enum = std::is_enum_v<E> && requires { { E::max }; };
+
+/**
+ *  @brief  Integral constant for the enumerator's @c max member.
+ *  @tparam  E  Container Utilities compatible enumerator type.
+ */
+template<cu_compatible_enum E>
+struct enum_max : std::integral_constant<std::underlying_type_t<E>,
+        std::to_underlying (E::max)> {};
+
+/**
+ *  @brief  Helper to get the value of the enumerator's @c max member.
+ *  @tparam  E  Container Utilities compatible enumerator type.
+ */
+template<cu_compatible_enum E>
+inline constexpr auto enum_max_v = enum_max<E>::value;
+
+namespace impl {
+
+/**
+ *  @brief  Get the name of an enumerator from the compiler's function
+ *          signature.
+ *
+ *  Supported on GCC and Clang, other compilers and values that are not
+ *  members of the enumerator give an empty name.
+ *
+ *  @tparam  V  The enumerator.
+ *  @return  The unqualified name of the enumerator.
+ */
+template<auto V>
+[[nodiscard]] consteval auto enumerator_name() -> std::string_view
+{
+#if defined(__GNUC__) || defined(__clang__)
+    // "... [with auto V = ns::E::name; ...]" on GCC, "... [V = ns::E::name]"
+    // on Clang, and "(ns::E)7" in place of the name for non-members.  The
+    // scope may be "(anonymous namespace)::" on Clang, so only the last
+    // segment is checked
+    std::string_view signature = __PRETTY_FUNCTION__;
+
+    auto start = signature.find("V = ") + 4;
+    auto name  = signature.substr(start,
+        signature.find_first_of(";]", start) - start);
+
+    name = name.substr(name.rfind(':') + 1);
+    if (name.empty() || (name[0] >= '0' && name[0] <= '9')
+     || name.find(')') != std::string_view::npos)
+    {
+        return {};
+    }
+    return name;
+#else
+    return {};
+#endif
+}
+
+/**
+ *  @brief  Get the names of all the enumerators below the @c max member.
+ *
+ *  @tparam  E  Container Utilities compatible enumerator type.
+ *  @tparam  I  The values of the enumerators.
+ *  @return  Array of names indexed by value.
+ */
+template<typename E, std::size_t... I>
+[[nodiscard]] consteval auto enumerator_names(std::index_sequence<I...>)
+{
+    return std::array<std::string_view, sizeof... (I)> {
+        enumerator_name<(E)I>()...
+    };
+}
+
+/**
+ *  @brief  FNV-1a hash of a string.
+ *
+ *  @tparam  Transform  A function type taking and returning a character.
+ *  @param   string     The string.
+ *  @param   transform  The function to apply to each character before
+ *                      hashing, such as lowering the case (optional).
+ *  @return  The hash.
+ */
+template<typename Transform = std::identity>
+[[nodiscard]] inline constexpr auto fnv1a(
+    std::string_view string,
+    Transform        transform = {}
+) -> std::uint64_t
+{
+    std::uint64_t hash = 0xcbf29ce484222325;
+    for (auto c : string)
+    {
+        hash ^= (unsigned char)transform(c);
+        hash *= 0x100000001b3;
+    }
+    return hash;
+}
+
+/**
+ *  @brief  Scramble a hash with a seed, the SplitMix64 finalizer.
+ *
+ *  @param  hash  The hash.
+ *  @param  seed  The seed.
+ *  @return  The scrambled hash.
+ */
+[[nodiscard]] inline constexpr auto scramble(
+    std::uint64_t hash,
+    std::uint64_t seed
+) -> std::uint64_t
+{
+    hash += seed * 0x9e3779b97f4a7c15;
+    hash  = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9;
+    hash  = (hash ^ (hash >> 27)) * 0x94d049bb133111eb;
+    return hash ^ (hash >> 31);
+}
+
+/**
+ *  @brief  Perfect hash of a fixed set of strings, built at compile time.
+ *
+ *  The strings are hashed into buckets, and each bucket gets a seed that
+ *  scrambles its strings into distinct slots of a table twice the size
+ *  (hash and displace).  A lookup is one hash of the string, one scramble and
+ *  one comparison.  Empty strings are not part of the set.
+ *
+ *  @tparam  N  The number of strings.
+ */
+template<std::size_t N>
+struct perfect_hash {
+
+    /**
+     *  @brief  The number of buckets.
+     */
+    static constexpr std::size_t buckets = std::bit_ceil(std::max(N,
+        (std::size_t)1));
+
+    /**
+     *  @brief  The number of slots.
+     */
+    static constexpr std::size_t slots = buckets * 2;
+
+    /**
+     *  @brief  Seed of each bucket.
+     */
+    std::array<std::uint64_t, buckets> seeds = {};
+
+    /**
+     *  @brief  Index of the string plus one in each slot, zero if empty.
+     */
+    std::array<std::size_t, slots> indices = {};
+
+    /**
+     *  @brief  Build the perfect hash of strings.
+     *  @param  keys  The strings, must be unique.
+     */
+    consteval perfect_hash(const std::array<std::string_view, N> &keys)
+    {
+        std::array<std::uint64_t, N>     hashes = {};
+        std::array<std::size_t, buckets> sizes  = {};
+        for (std::size_t i = 0; i < N; i++)
+        {
+            hashes[i] = fnv1a(keys[i]);
+            if (!keys[i].empty()) sizes[hashes[i] % buckets]++;
+        }
+
+        // Largest buckets are the hardest to place, place them first
+        for (std::size_t size = N; size > 0; size--)
+        {
+            for (std::size_t bucket = 0; bucket < buckets; bucket++)
+            {
+                if (sizes[bucket] == size) place(keys, hashes, bucket);
+            }
+        }
+    }
+
+    /**
+     *  @brief  Find a seed that places all the strings of a bucket.
+     *
+     *  @param  keys    The strings.
+     *  @param  hashes  Hash of each string.
+     *  @param  bucket  The bucket.
+     */
+    consteval auto place(
+        const std::array<std::string_view, N> &keys,
+        const std::array<std::uint64_t, N>    &hashes,
+        std::size_t                            bucket
+    ) -> void
+    {
+        for (std::uint64_t seed = 1; seed < 1 << 20; seed++)
+        {
+            std::array<std::size_t, N> placed = {};
+            std::size_t                count  = 0;
+
+            auto fits = true;
+            for (std::size_t i = 0; i < N && fits; i++)
+            {
+                if (keys[i].empty() || hashes[i] % buckets != bucket) continue;
+
+                auto slot = scramble(hashes[i], seed) % slots;
+                fits = indices[slot] == 0
+                    && std::find(placed.begin(), placed.begin() + count, slot)
+                        == placed.begin() + count;
+                placed[count++] = slot;
+            }
+            if (!fits) continue;
+
+            for (std::size_t i = 0, j = 0; i < N; i++)
+            {
+                if (keys[i].empty() || hashes[i] % buckets != bucket) continue;
+                indices[placed[j++]] = i + 1;
+            }
+            seeds[bucket] = seed;
+            return;
+        }
+
+        throw "No perfect hash, are the strings unique?";
+    }
+
+    /**
+     *  @brief  Find the index of a string.
+     *
+     *  @param  key  The string.
+     *  @return  Index of the only string that may be equal to @c key , or
+     *           @c N if there is none.
+     */
+    [[nodiscard]] inline constexpr auto find(std::string_view key) const
+    -> std::size_t
+    {
+        auto hash  = fnv1a(key);
+        auto index = indices[scramble(hash, seeds[hash % buckets]) % slots];
+        return index == 0 ? N : index - 1;
+    }
+};
+
+} // namespace impl
+
+/**
+ *  @brief  Names of the enumerators, indexed by value.
+ *
+ *  By default the names are extracted from the compiler on GCC and Clang.
+ *  Specialize this with a @c names member of
+ *  @c std::array<std::string_view, enum_max_v<E>> to supply the names.
+ *
+ *  @tparam  E  Container Utilities compatible enumerator type.
+ */
+template<cu_compatible_enum E>
+struct enum_name_list {
+
+    /**
+     *  @brief  The names, empty for values that are not members.
+     */
+    static constexpr auto names = impl::enumerator_names<E>(
+        std::make_index_sequence<(std::size_t)enum_max_v<E>>());
+};
+
+/**
+ *  @brief  Helper to get the names of the enumerators.
+ *  @tparam  E  Container Utilities compatible enumerator type.
+ */
+template<cu_compatible_enum E>
+inline constexpr auto &enum_names_v = enum_name_list<E>::names;
+
+/**
+ *  @brief  Perfect hash of the names of the enumerators.
+ *  @tparam  E  Container Utilities compatible enumerator type.
+ */
+template<cu_compatible_enum E>
+inline constexpr auto enum_names_hash = impl::perfect_hash<
+    std::tuple_size_v<std::remove_cvref_t<decltype(enum_names_v<E>)>>>(
+        enum_names_v<E>);
+
+/**
+ *  @brief  Convert an enumerator to its name.
+ *
+ *  @tparam  E  Container Utilities compatible enumerator type.
+ *  @param   e  The enumerator.
+ *  @return  Name of the enumerator, or empty string if it has no name.
+ */
+template<cu_compatible_enum E>
+[[nodiscard]] inline constexpr auto enum_to_string(E e) -> std::string_view
+{
+    auto index = (std::size_t)std::to_underlying(e);
+    if (index >= enum_names_v<E>.size()) return {};
+    return enum_names_v<E>[index];
+}
+
+/**
+ *  @brief  Convert a name to its enumerator.
+ *
+ *  @tparam  E     Container Utilities compatible enumerator type.
+ *  @param   name  Name of the enumerator.
+ *  @return  The enumerator, or nothing if no enumerator has the name.
+ */
+template<cu_compatible_enum E>
+[[nodiscard]] inline constexpr auto enum_from_string(std::string_view name)
+-> std::optional<E>
+{
+    auto index = enum_names_hash<E>.find(name);
+    if (index >= enum_names_v<E>.size() || name.empty()) return std::nullopt;
+    if (enum_names_v<E>[index] != name) return std::nullopt;
+    return (E)index;
+}
+
+/**
+ *  @brief  Array with enumerator as index.
+ *
+ *  @tparam  T  The type of element.
+ *  @tparam  E  A Container Utilities compatible enumerator type.
+ */
+template<typename T, cu_compatible_enum E>
+struct enumerated_array : std::array<T, enum_max_v<E>> {
+
+    /**
+     *  @brief  Base class, template arguments are long.
+     */
+    using base = std::array<T, enum_max_v<E>>;
+
+    /**
+     *  @brief  Get the element at enumerator.
+     *
+     *  @param  enumerator  Enumerator specifying index.
+     *  @return  Element at index.
+     */
+    [[nodiscard]] inline constexpr auto operator[] (E e) -> T &
+    {
+        return base::operator[] (std::to_underlying(e));
+    }
+
+    /**
+     *  @brief  Get the element at enumerator.
+     *
+     *  @param  enumerator  Enumerator specifying index.
+     *  @return  Element at index.
+     */
+    [[nodiscard]] inline constexpr auto operator[] (E e) const -> const T &
+    {
+        return base::operator[] (std::to_underlying(e));
+    }
+
+    /**
+     *  @brief  Get the element at enumerator.
+     *
+     *  @param  enumerator  Enumerator specifying index.
+     *  @return  Element at index.
+     */
+    [[nodiscard]] inline constexpr auto at(E e) -> T &
+    {
+        return base::at(std::to_underlying(e));
+    }
+
+    /**
+     *  @brief  Get the element at enumerator.
+     *
+     *  @param  enumerator  Enumerator specifying index.
+     *  @return  Element at index.
+     */
+    [[nodiscard]] inline constexpr auto at(E e) const -> const T &
+    {
+        return base::at(std::to_underlying(e));
+    }
+};
+
+/**
+ *  @brief  Multi-dimensional array with enumerators as indices.
+ *
+ *  The elements are stored in row-major order, the last enumerator is the
+ *  fastest varying index.
+ *
+ *  @tparam  T   The type of element.
+ *  @tparam  Es  Container Utilities compatible enumerator types, one for each
+ *               dimension.
+ */
+template<typename T, cu_compatible_enum... Es>
+requires(sizeof... (Es) > 0)
+struct enumerated_array_nd
+    : std::array<T, ((std::size_t)enum_max_v<Es> * ...)> {
+
+    /**
+     *  @brief  Base class, template arguments are long.
+     */
+    using base = std::array<T, ((std::size_t)enum_max_v<Es> * ...)>;
+
+    /**
+     *  @brief  The number of enumerators of each dimension.
+     */
+    static constexpr std::array<std::size_t, sizeof... (Es)> extents = {
+        (std::size_t)enum_max_v<Es>...
+    };
+
+    /**
+     *  @brief  Get the row-major index of the enumerators.
+     *
+     *  @param  es  Enumerators specifying index of each dimension.
+     *  @return  Index of the element.
+     */
+    [[nodiscard]] static inline constexpr auto index(Es... es) -> std::size_t
+    {
+        std::size_t index = 0;
+        std::size_t i     = 0;
+        ((index = index * extents[i++] + (std::size_t)std::to_underlying(es)),
+            ...);
+        return index;
+    }
+
+    /**
+     *  @brief  Get the row-major index of the enumerators, with bounds
+     *          checking of each dimension.
+     *
+     *  @param  es  Enumerators specifying index of each dimension.
+     *  @return  Index of the element.
+     *  @throw  @c std::out_of_range  If any enumerator is out of its
+     *          dimension's range.
+     */
+    [[nodiscard]] static inline constexpr auto checked_index(Es... es)
+    -> std::size_t
+    {
+        std::size_t i = 0;
+        if (!(((std::size_t)std::to_underlying(es) < extents[i++]) && ...))
+        {
+            throw std::out_of_range("enumerated_array_nd::at");
+        }
+        return index(es...);
+    }
+
+    /**
+     *  @brief  Get the element at enumerators.
+     *
+     *  @param  es  Enumerators specifying index of each dimension.
+     *  @return  Element at index.
+     */
+    [[nodiscard]] inline constexpr auto operator[] (Es... es) -> T &
+    {
+        return base::operator[] (index(es...));
+    }
+
+    /**
+     *  @brief  Get the element at enumerators.
+     *
+     *  @param  es  Enumerators specifying index of each dimension.
+     *  @return  Element at index.
+     */
+    [[nodiscard]] inline constexpr auto operator[] (Es... es) const
+    -> const T &
+    {
+        return base::operator[] (index(es...));
+    }
+
+    /**
+     *  @brief  Get the element at enumerators.
+     *
+     *  @param  es  Enumerators specifying index of each dimension.
+     *  @return  Element at index.
+     *  @throw  @c std::out_of_range  If any enumerator is out of its
+     *          dimension's range.
+     */
+    [[nodiscard]] inline constexpr auto at(Es... es) -> T &
+    {
+        return base::operator[] (checked_index(es...));
+    }
+
+    /**
+     *  @brief  Get the element at enumerators.
+     *
+     *  @param  es  Enumerators specifying index of each dimension.
+     *  @return  Element at index.
+     *  @throw  @c std::out_of_range  If any enumerator is out of its
+     *          dimension's range.
+     */
+    [[nodiscard]] inline constexpr auto at(Es... es) const -> const T &
+    {
+        return base::operator[] (checked_index(es...));
+    }
+};
+
+/**
+ *  @brief  Two-dimensional array with enumerators as indices.
+ *
+ *  @tparam  T   The type of element.
+ *  @tparam  E1  A Container Utilities compatible enumerator type for rows.
+ *  @tparam  E2  A Container Utilities compatible enumerator type for columns.
+ */
+template<typename T, cu_compatible_enum E1, cu_compatible_enum E2>
+using enumerated_array2d = enumerated_array_nd<T, E1, E2>;
+
+/**
+ *  @brief  Struct of arrays with enumerator as index.
+ *
+ *  Each field is stored in its own contiguous array, so scanning one field
+ *  across all the enumerators only touches that field.
+ *
+ *  @tparam  E       A Container Utilities compatible enumerator type.
+ *  @tparam  Fields  The types of fields.
+ */
+template<cu_compatible_enum E, typename... Fields>
+struct enumerated_soa {
+
+    /**
+     *  @brief  The number of enumerators.
+     */
+    static constexpr std::size_t extent = enum_max_v<E>;
+
+    /**
+     *  @brief  Array of each field.
+     */
+    std::tuple<std::array<Fields, extent>...> columns = {};
+
+    /**
+     *  @brief  Get the number of enumerators.
+     *  @return  The number of enumerators.
+     */
+    [[nodiscard]] inline constexpr auto size() const
+    {
+        return extent;
+    }
+
+    /**
+     *  @brief  Get the array of a field.
+     *
+     *  @tparam  I  Index of the field.
+     *  @return  Array of the field.
+     */
+    template<std::size_t I>
+    [[nodiscard]] inline constexpr auto field() -> auto &
+    {
+        return std::get<I>(columns);
+    }
+
+    /**
+     *  @brief  Get the array of a field.
+     *
+     *  @tparam  I  Index of the field.
+     *  @return  Array of the field.
+     */
+    template<std::size_t I>
+    [[nodiscard]] inline constexpr auto field() const -> const auto &
+    {
+        return std::get<I>(columns);
+    }
+
+    /**
+     *  @brief  Get a field at enumerator.
+     *
+     *  @tparam  I  Index of the field.
+     *  @param   e  Enumerator specifying index.
+     *  @return  Field at index.
+     */
+    template<std::size_t I>
+    [[nodiscard]] inline constexpr auto get(E e) -> auto &
+    {
+        return std::get<I>(columns)[std::to_underlying(e)];
+    }
+
+    /**
+     *  @brief  Get a field at enumerator.
+     *
+     *  @tparam  I  Index of the field.
+     *  @param   e  Enumerator specifying index.
+     *  @return  Field at index.
+     */
+    template<std::size_t I>
+    [[nodiscard]] inline constexpr auto get(E e) const -> const auto &
+    {
+        return std::get<I>(columns)[std::to_underlying(e)];
+    }
+
+    /**
+     *  @brief  Get all the fields at enumerator.
+     *
+     *  @param  e  Enumerator specifying index.
+     *  @return  Tuple of references to the fields.
+     */
+    [[nodiscard]] inline constexpr auto operator[] (E e)
+    {
+        return std::apply([&](auto &...arrays) {
+            return std::tie(arrays[std::to_underlying(e)]...);
+        }, columns);
+    }
+
+    /**
+     *  @brief  Get all the fields at enumerator.
+     *
+     *  @param  e  Enumerator specifying index.
+     *  @return  Tuple of references to the fields.
+     */
+    [[nodiscard]] inline constexpr auto operator[] (E e) const
+    {
+        return std::apply([&](const auto &...arrays) {
+            return std::tie(arrays[std::to_underlying(e)]...);
+        }, columns);
+    }
+};
+
+/**
+ *  @brief  Set of enumerators packed into 64-bit words.
+ *
+ *  Each enumerator takes a single bit, so testing a flag is a single
+ *  instruction and small enumerators fit in a register.
+ *
+ *  @tparam  E  A Container Utilities compatible enumerator type.
+ */
+template<cu_compatible_enum E>
+struct enumerated_bitset {
+
+    /**
+     *  @brief  The number of enumerators.
+     */
+    static constexpr std::size_t bits = enum_max_v<E>;
+
+    /**
+     *  @brief  The number of words holding the bits.
+     */
+    static constexpr std::size_t word_count = (bits + 63) / 64;
+
+    /**
+     *  @brief  The bits of the last word that belong to enumerators.
+     */
+    static constexpr std::uint64_t last_mask = bits % 64 == 0
+        ? ~(std::uint64_t)0 : ((std::uint64_t)1 << (bits % 64)) - 1;
+
+    /**
+     *  @brief  Packed bits, bit @c i of word @c w is the enumerator
+     *          @c w*64+i .
+     */
+    std::array<std::uint64_t, word_count> words = {};
+
+    /**
+     *  @brief  Forward iterator over the set enumerators, in order.
+     */
+    struct iterator {
+
+        /**
+         *  @brief  Iterator concept.
+         */
+        using iterator_concept = std::forward_iterator_tag;
+
+        /**
+         *  @brief  Iterator category.
+         */
+        using iterator_category = std::input_iterator_tag;
+
+        /**
+         *  @brief  Iterator value type.
+         */
+        using value_type = E;
+
+        /**
+         *  @brief  Iterator difference type.
+         */
+        using difference_type = std::ptrdiff_t;
+
+        /**
+         *  @brief  The bitset this iterator belongs to.
+         */
+        const enumerated_bitset *parent = nullptr;
+
+        /**
+         *  @brief  Index of the current set bit, @c bits at the end.
+         */
+        std::size_t index = bits;
+
+        /**
+         *  @brief  Get the current enumerator.
+         *  @return  Current enumerator.
+         */
+        [[nodiscard]] inline constexpr auto operator* () const
+        {
+            return (E)index;
+        }
+
+        /**
+         *  @brief  Advance to the next set enumerator.
+         *  @return  Reference to self.
+         */
+        inline constexpr auto operator++ () -> iterator &
+        {
+            index = parent->next(index + 1);
+            return *this;
+        }
+
+        /**
+         *  @brief  Advance to the next set enumerator.
+         *  @return  Copy of self before advancing.
+         */
+        inline constexpr auto operator++ (int) -> iterator
+        {
+            auto copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        /**
+         *  @brief  Compare two iterators.
+         *
+         *  @param  a  The first iterator.
+         *  @param  b  The second iterator.
+         *  @return  True if both are at the same enumerator.
+         */
+        [[nodiscard]] friend inline constexpr auto operator== (
+            const iterator &a,
+            const iterator &b
+        ) -> bool
+        {
+            return a.index == b.index;
+        }
+    };
+
+    /**
+     *  @brief  Creates an empty bitset.
+     */
+    inline constexpr enumerated_bitset() = default;
+
+    /**
+     *  @brief  Creates a bitset with enumerators set.
+     *  @param  list  The enumerators to set.
+     */
+    inline constexpr enumerated_bitset(std::initializer_list<E> list)
+    {
+        for (auto e : list) set(e);
+    }
+
+    /**
+     *  @brief  Get the number of enumerators.
+     *  @return  The number of enumerators.
+     */
+    [[nodiscard]] inline constexpr auto size() const
+    {
+        return bits;
+    }
+
+    /**
+     *  @brief  Check if the enumerator is set.
+     *
+     *  @param  e  The enumerator.
+     *  @return  True if the enumerator is set.
+     */
+    [[nodiscard]] inline constexpr auto test(E e) const -> bool
+    {
+        auto index = (std::size_t)std::to_underlying(e);
+        return (words[index / 64] >> (index % 64)) & 1;
+    }
+
+    /**
+     *  @brief  Check if the enumerator is set.
+     *
+     *  @param  e  The enumerator.
+     *  @return  True if the enumerator is set.
+     */
+    [[nodiscard]] inline constexpr auto operator[] (E e) const -> bool
+    {
+        return test(e);
+    }
+
+    /**
+     *  @brief  Set or clear the enumerator.
+     *
+     *  @param  e      The enumerator.
+     *  @param  value  True to set, false to clear.
+     *  @return  Reference to self.
+     */
+    inline constexpr auto set(E e, bool value = true) -> enumerated_bitset &
+    {
+        auto index = (std::size_t)std::to_underlying(e);
+        auto bit   = (std::uint64_t)1 << (index % 64);
+        if (value) words[index / 64] |= bit;
+        else       words[index / 64] &= ~bit;
+        return *this;
+    }
+
+    /**
+     *  @brief  Clear the enumerator.
+     *
+     *  @param  e  The enumerator.
+     *  @return  Reference to self.
+     */
+    inline constexpr auto reset(E e) -> enumerated_bitset &
+    {
+        return set(e, false);
+    }
+
+    /**
+     *  @brief  Toggle the enumerator.
+     *
+     *  @param  e  The enumerator.
+     *  @return  Reference to self.
+     */
+    inline constexpr auto flip(E e) -> enumerated_bitset &
+    {
+        auto index = (std::size_t)std::to_underlying(e);
+        words[index / 64] ^= (std::uint64_t)1 << (index % 64);
+        return *this;
+    }
+
+    /**
+     *  @brief  Set all the enumerators.
+     *  @return  Reference to self.
+     */
+    inline constexpr auto set() -> enumerated_bitset &
+    {
+        words.fill(~(std::uint64_t)0);
+        return mask();
+    }
+
+    /**
+     *  @brief  Clear all the enumerators.
+     *  @return  Reference to self.
+     */
+    inline constexpr auto reset() -> enumerated_bitset &
+    {
+        words.fill(0);
+        return *this;
+    }
+
+    /**
+     *  @brief  Toggle all the enumerators.
+     *  @return  Reference to self.
+     */
+    inline constexpr auto flip() -> enumerated_bitset &
+    {
+        for (auto &word : words) word = ~word;
+        return mask();
+    }
+
+    /**
+     *  @brief  Clear the bits past the last enumerator.
+     *  @return  Reference to self.
+     */
+    inline constexpr auto mask() -> enumerated_bitset &
+    {
+        if constexpr (word_count != 0) words.back() &= last_mask;
+        return *this;
+    }
+
+    /**
+     *  @brief  Get the number of set enumerators.
+     *  @return  The number of set enumerators.
+     */
+    [[nodiscard]] inline constexpr auto count() const
+    {
+        std::size_t count = 0;
+        for (auto word : words) count += std::popcount(word);
+        return count;
+    }
+
+    /**
+     *  @brief  Check if all the enumerators are set.
+     *  @return  True if all the enumerators are set.
+     */
+    [[nodiscard]] inline constexpr auto all() const
+    {
+        return count() == bits;
+    }
+
+    /**
+     *  @brief  Check if any enumerator is set.
+     *  @return  True if any enumerator is set.
+     */
+    [[nodiscard]] inline constexpr auto any() const
+    {
+        return std::ranges::any_of(words,
+            [](std::uint64_t word) { return word != 0; });
+    }
+
+    /**
+     *  @brief  Check if no enumerator is set.
+     *  @return  True if no enumerator is set.
+     */
+    [[nodiscard]] inline constexpr auto none() const
+    {
+        return !any();
+    }
+
+    /**
+     *  @brief  Find the first set bit at or after index.
+     *
+     *  @param  index  The index to start from.
+     *  @return  Index of the set bit, or @c bits if there is none.
+     */
+    [[nodiscard]] inline constexpr auto next(std::size_t index) const
+    -> std::size_t
+    {
+        if (index >= bits) return bits;
+
+        auto w    = index / 64;
+        auto word = words[w] & (~(std::uint64_t)0 << (index % 64));
+        while (word == 0)
+        {
+            if (++w == word_count) return bits;
+            word = words[w];
+        }
+        return w * 64 + std::countr_zero(word);
+    }
+
+    /**
+     *  @brief  Find the last set bit before index.
+     *
+     *  @param  index  The index to search backwards from, exclusive.
+     *  @return  Index of the set bit, or @c bits if there is none.
+     */
+    [[nodiscard]] inline constexpr auto previous(std::size_t index) const
+    -> std::size_t
+    {
+        index = std::min(index, bits);
+        if (index == 0) return bits;
+
+        auto w    = (index - 1) / 64;
+        auto word = words[w] & (~(std::uint64_t)0 >> (63 - (index - 1) % 64));
+        while (word == 0)
+        {
+            if (w-- == 0) return bits;
+            word = words[w];
+        }
+        return w * 64 + 63 - std::countl_zero(word);
+    }
+
+    /**
+     *  @brief  Get the iterator to the first set enumerator.
+     *  @return  Iterator to the first set enumerator.
+     */
+    [[nodiscard]] inline constexpr auto begin() const -> iterator
+    {
+        return { this, next(0) };
+    }
+
+    /**
+     *  @brief  Get the iterator past the last set enumerator.
+     *  @return  Iterator past the last set enumerator.
+     */
+    [[nodiscard]] inline constexpr auto end() const -> iterator
+    {
+        return { this, bits };
+    }
+
+    /**
+     *  @brief  Keep the enumerators set in both.
+     *
+     *  @param  other  The other bitset.
+     *  @return  Reference to self.
+     */
+    inline constexpr auto operator&= (
+        const enumerated_bitset &other
+    ) -> enumerated_bitset &
+    {
+        for (std::size_t i = 0; i < word_count; i++)
+        {
+            words[i] &= other.words[i];
+        }
+        return *this;
+    }
+
+    /**
+     *  @brief  Set the enumerators set in the other.
+     *
+     *  @param  other  The other bitset.
+     *  @return  Reference to self.
+     */
+    inline constexpr auto operator|= (
+        const enumerated_bitset &other
+    ) -> enumerated_bitset &
+    {
+        for (std::size_t i = 0; i < word_count; i++)
+        {
+            words[i] |= other.words[i];
+        }
+        return *this;
+    }
+
+    /**
+     *  @brief  Toggle the enumerators set in the other.
+     *
+     *  @param  other  The other bitset.
+     *  @return  Reference to self.
+     */
+    inline constexpr auto operator^= (
+        const enumerated_bitset &other
+    ) -> enumerated_bitset &
+    {
+        for (std::size_t i = 0; i < word_count; i++)
+        {
+            words[i] ^= other.words[i];
+        }
+        return *this;
+    }
+
+    /**
+     *  @brief  Get the enumerators set in both.
+     *
+     *  @param  a  The first bitset.
+     *  @param  b  The second bitset.
+     *  @return  Intersection of both.
+     */
+    [[nodiscard]] friend inline constexpr auto operator& (
+        enumerated_bitset        a,
+        const enumerated_bitset &b
+    ) -> enumerated_bitset
+    {
+        return a &= b;
+    }
+
+    /**
+     *  @brief  Get the enumerators set in either.
+     *
+     *  @param  a  The first bitset.
+     *  @param  b  The second bitset.
+     *  @return  Union of both.
+     */
+    [[nodiscard]] friend inline constexpr auto operator| (
+        enumerated_bitset        a,
+        const enumerated_bitset &b
+    ) -> enumerated_bitset
+    {
+        return a |= b;
+    }
+
+    /**
+     *  @brief  Get the enumerators set in exactly one.
+     *
+     *  @param  a  The first bitset.
+     *  @param  b  The second bitset.
+     *  @return  Symmetric difference of both.
+     */
+    [[nodiscard]] friend inline constexpr auto operator^ (
+        enumerated_bitset        a,
+        const enumerated_bitset &b
+    ) -> enumerated_bitset
+    {
+        return a ^= b;
+    }
+
+    /**
+     *  @brief  Get the enumerators not set.
+     *
+     *  @param  a  The bitset.
+     *  @return  Complement of the bitset.
+     */
+    [[nodiscard]] friend inline constexpr auto operator~ (
+        enumerated_bitset a
+    ) -> enumerated_bitset
+    {
+        return a.flip();
+    }
+
+    /**
+     *  @brief  Compare two bitsets.
+     *
+     *  @param  a  The first bitset.
+     *  @param  b  The second bitset.
+     *  @return  True if both have the same enumerators set.
+     */
+    [[nodiscard]] friend inline constexpr auto operator== (
+        const enumerated_bitset &a,
+        const enumerated_bitset &b
+    ) -> bool = default;
+};
+
+/**
+ *  @brief  Map with enumerator as key, storing the elements in an
+ *          @c enumerated_array and their presence in an @c enumerated_bitset .
+ *
+ *  Inserting, erasing and looking up is an array index and never allocates.
+ *  Iteration visits the present keys only, in order.  Requires a
+ *  default-constructible type, absent keys hold a default constructed element.
+ *
+ *  @tparam  T  The type of element.
+ *  @tparam  E  A Container Utilities compatible enumerator type.
+ */
+template<typename T, cu_compatible_enum E>
+requires(std::is_default_constructible_v<T>)
+struct enumerated_optional_map {
+
+    /**
+     *  @brief  Key type.
+     */
+    using key_type = E;
+
+    /**
+     *  @brief  Mapped type.
+     */
+    using mapped_type = T;
+
+    /**
+     *  @brief  Elements at every key, present or not.
+     */
+    enumerated_array<T, E> values = {};
+
+    /**
+     *  @brief  The present keys.
+     */
+    enumerated_bitset<E> present = {};
+
+    /**
+     *  @brief  Bidirectional iterator over the present keys and their
+     *          elements.
+     *  @tparam  Const  True to iterate over constant elements.
+     */
+    template<bool Const>
+    struct basic_iterator {
+
+        /**
+         *  @brief  Iterator concept.
+         */
+        using iterator_concept = std::bidirectional_iterator_tag;
+
+        /**
+         *  @brief  Iterator category.
+         */
+        using iterator_category = std::input_iterator_tag;
+
+        /**
+         *  @brief  Iterator value type, pair of key and reference to element.
+         */
+        using value_type = std::pair<E, std::conditional_t<Const, const T &,
+            T &>>;
+
+        /**
+         *  @brief  Iterator difference type.
+         */
+        using difference_type = std::ptrdiff_t;
+
+        /**
+         *  @brief  Pointer to the pair of key and element, holding the pair
+         *          as it is not stored in the map.
+         */
+        struct pointer {
+
+            /**
+             *  @brief  The pair of key and reference to element.
+             */
+            value_type pair;
+
+            /**
+             *  @brief  Access the pair.
+             *  @return  Pointer to the pair.
+             */
+            [[nodiscard]] inline constexpr auto operator-> () -> value_type *
+            {
+                return &pair;
+            }
+        };
+
+        /**
+         *  @brief  The map this iterator belongs to.
+         */
+        std::conditional_t<Const, const enumerated_optional_map,
+            enumerated_optional_map> *parent = nullptr;
+
+        /**
+         *  @brief  Index of the current key, @c enum_max_v<E> at the end.
+         */
+        std::size_t index = enum_max_v<E>;
+
+        /**
+         *  @brief  Convert to a constant iterator.
+         *  @return  Constant iterator at the same key.
+         */
+        inline constexpr operator basic_iterator<true> () const
+        requires(!Const)
+        {
+            return { parent, index };
+        }
+
+        /**
+         *  @brief  Get the current key and element.
+         *  @return  Pair of current key and reference to element.
+         */
+        [[nodiscard]] inline constexpr auto operator* () const -> value_type
+        {
+            return { (E)index, parent->values[(E)index] };
+        }
+
+        /**
+         *  @brief  Access the current key and element.
+         *  @return  Pointer to pair of current key and reference to element.
+         */
+        [[nodiscard]] inline constexpr auto operator-> () const -> pointer
+        {
+            return { **this };
+        }
+
+        /**
+         *  @brief  Advance to the next present key.
+         *  @return  Reference to self.
+         */
+        inline constexpr auto operator++ () -> basic_iterator &
+        {
+            index = parent->present.next(index + 1);
+            return *this;
+        }
+
+        /**
+         *  @brief  Advance to the next present key.
+         *  @return  Copy of self before advancing.
+         */
+        inline constexpr auto operator++ (int) -> basic_iterator
+        {
+            auto copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        /**
+         *  @brief  Go back to the previous present key.
+         *  @return  Reference to self.
+         */
+        inline constexpr auto operator-- () -> basic_iterator &
+        {
+            index = parent->present.previous(index);
+            return *this;
+        }
+
+        /**
+         *  @brief  Go back to the previous present key.
+         *  @return  Copy of self before going back.
+         */
+        inline constexpr auto operator-- (int) -> basic_iterator
+        {
+            auto copy = *this;
+            --*this;
+            return copy;
+        }
+
+        /**
+         *  @brief  Compare two iterators.
+         *
+         *  @param  a  The first iterator.
+         *  @param  b  The second iterator.
+         *  @return  True if both are at the same key.
+         */
+        [[nodiscard]] friend inline constexpr auto operator== (
+            const basic_iterator &a,
+            const basic_iterator &b
+        ) -> bool
+        {
+            return a.index == b.index;
+        }
+    };
+
+    /**
+     *  @brief  Iterator over the present keys.
+     */
+    using iterator = basic_iterator<false>;
+
+    /**
+     *  @brief  Iterator over the present keys with constant elements.
+     */
+    using const_iterator = basic_iterator<true>;
+
+    /**
+     *  @brief  Iterator over the present keys in reverse.
+     */
+    using reverse_iterator = std::reverse_iterator<iterator>;
+
+    /**
+     *  @brief  Iterator over the present keys in reverse with constant
+     *          elements.
+     */
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    /**
+     *  @brief  Creates an empty map.
+     */
+    inline constexpr enumerated_optional_map() = default;
+
+    /**
+     *  @brief  Creates a map from pairs of key and element.
+     *  @param  list  The pairs of key and element.
+     */
+    inline constexpr enumerated_optional_map(
+        std::initializer_list<std::pair<E, T>> list
+    )
+    {
+        for (const auto &[key, value] : list) insert_or_assign(key, value);
+    }
+
+    /**
+     *  @brief  Get the number of present keys.
+     *  @return  The number of present keys.
+     */
+    [[nodiscard]] inline constexpr auto size() const
+    {
+        return present.count();
+    }
+
+    /**
+     *  @brief  Get the largest number of keys.
+     *  @return  The number of enumerators.
+     */
+    [[nodiscard]] inline constexpr auto max_size() const
+    {
+        return present.size();
+    }
+
+    /**
+     *  @brief  Check if there are no present keys.
+     *  @return  True if there are no present keys.
+     */
+    [[nodiscard]] inline constexpr auto empty() const
+    {
+        return present.none();
+    }
+
+    /**
+     *  @brief  Check if the key is present.
+     *
+     *  @param  key  The key.
+     *  @return  True if the key is present.
+     */
+    [[nodiscard]] inline constexpr auto contains(E key) const -> bool
+    {
+        return present.test(key);
+    }
+
+    /**
+     *  @brief  Get the number of elements at key.
+     *
+     *  @param  key  The key.
+     *  @return  1 if the key is present, otherwise 0.
+     */
+    [[nodiscard]] inline constexpr auto count(E key) const -> std::size_t
+    {
+        return contains(key);
+    }
+
+    /**
+     *  @brief  Find the element at key.
+     *
+     *  @param  key  The key.
+     *  @return  Iterator to the key, or end if the key is not present.
+     */
+    [[nodiscard]] inline constexpr auto find(E key) -> iterator
+    {
+        if (!contains(key)) return end();
+        return { this, (std::size_t)std::to_underlying(key) };
+    }
+
+    /**
+     *  @brief  Find the element at key.
+     *
+     *  @param  key  The key.
+     *  @return  Iterator to the key, or end if the key is not present.
+     */
+    [[nodiscard]] inline constexpr auto find(E key) const -> const_iterator
+    {
+        if (!contains(key)) return end();
+        return { this, (std::size_t)std::to_underlying(key) };
+    }
+
+    /**
+     *  @brief  Access element at key.
+     *
+     *  @param  key                   The key.
+     *  @throw  @c std::out_of_range  If the key is not present.
+     *  @return  Element at key.
+     */
+    [[nodiscard]] inline constexpr auto at(E key) -> T &
+    {
+        if (!contains(key))
+        {
+            throw std::out_of_range("enumerated_optional_map::at");
+        }
+        return values[key];
+    }
+
+    /**
+     *  @brief  Access element at key.
+     *
+     *  @param  key                   The key.
+     *  @throw  @c std::out_of_range  If the key is not present.
+     *  @return  Element at key.
+     */
+    [[nodiscard]] inline constexpr auto at(E key) const -> const T &
+    {
+        if (!contains(key))
+        {
+            throw std::out_of_range("enumerated_optional_map::at");
+        }
+        return values[key];
+    }
+
+    /**
+     *  @brief  Access element at key, making the key present.
+     *
+     *  @param  key  The key.
+     *  @return  Element at key, default constructed if it was not present.
+     */
+    [[nodiscard]] inline constexpr auto operator[] (E key) -> T &
+    {
+        present.set(key);
+        return values[key];
+    }
+
+    /**
+     *  @brief  Construct an element at key if the key is not present.
+     *
+     *  @tparam  Args  The types of arguments.
+     *  @param   key   The key.
+     *  @param   args  The arguments to construct the element with.
+     *  @return  Iterator to the key and true if the element was inserted.
+     */
+    template<typename... Args>
+    inline constexpr auto try_emplace(
+        E         key,
+        Args &&...args
+    ) -> std::pair<iterator, bool>
+    {
+        iterator it = { this, (std::size_t)std::to_underlying(key) };
+        if (contains(key)) return { it, false };
+
+        values[key] = T(std::forward<Args>(args)...);
+        present.set(key);
+        return { it, true };
+    }
+
+    /**
+     *  @brief  Insert an element at key if the key is not present.
+     *
+     *  @param  key    The key.
+     *  @param  value  The element.
+     *  @return  Iterator to the key and true if the element was inserted.
+     */
+    inline constexpr auto insert(
+        E        key,
+        const T &value
+    ) -> std::pair<iterator, bool>
+    {
+        return try_emplace(key, value);
+    }
+
+    /**
+     *  @brief  Insert or replace the element at key.
+     *
+     *  @tparam  U      The type of element to assign.
+     *  @param   key    The key.
+     *  @param   value  The element.
+     *  @return  Iterator to the key and true if the element was inserted.
+     */
+    template<typename U>
+    inline constexpr auto insert_or_assign(
+        E   key,
+        U &&value
+    ) -> std::pair<iterator, bool>
+    {
+        bool inserted = !contains(key);
+        values[key] = std::forward<U>(value);
+        present.set(key);
+        return { { this, (std::size_t)std::to_underlying(key) }, inserted };
+    }
+
+    /**
+     *  @brief  Remove the element at key.
+     *
+     *  @param  key  The key.
+     *  @return  The number of elements removed.
+     */
+    inline constexpr auto erase(E key) -> std::size_t
+    {
+        if (!contains(key)) return 0;
+
+        // Release resources held by removed element
+        values[key] = T();
+        present.reset(key);
+        return 1;
+    }
+
+    /**
+     *  @brief  Remove all the elements.
+     */
+    inline constexpr auto clear() -> void
+    {
+        for (auto key : present) values[key] = T();
+        present.reset();
+    }
+
+    /**
+     *  @brief  Swap elements with another map.
+     *  @param  other  The other map.
+     */
+    inline constexpr auto swap(enumerated_optional_map &other) -> void
+    {
+        std::swap(values, other.values);
+        std::swap(present, other.present);
+    }
+
+    /**
+     *  @brief  Get the iterator to the first present key.
+     *  @return  Iterator to the first present key.
+     */
+    [[nodiscard]] inline constexpr auto begin() -> iterator
+    {
+        return { this, present.next(0) };
+    }
+
+    /**
+     *  @brief  Get the iterator to the first present key.
+     *  @return  Iterator to the first present key.
+     */
+    [[nodiscard]] inline constexpr auto begin() const -> const_iterator
+    {
+        return { this, present.next(0) };
+    }
+
+    /**
+     *  @brief  Get the iterator past the last present key.
+     *  @return  Iterator past the last present key.
+     */
+    [[nodiscard]] inline constexpr auto end() -> iterator
+    {
+        return { this, present.size() };
+    }
+
+    /**
+     *  @brief  Get the iterator past the last present key.
+     *  @return  Iterator past the last present key.
+     */
+    [[nodiscard]] inline constexpr auto end() const -> const_iterator
+    {
+        return { this, present.size() };
+    }
+
+    /**
+     *  @brief  Get the constant iterator to the first present key.
+     *  @return  Constant iterator to the first present key.
+     */
+    [[nodiscard]] inline constexpr auto cbegin() const -> const_iterator
+    {
+        return begin();
+    }
+
+    /**
+     *  @brief  Get the constant iterator past the last present key.
+     *  @return  Constant iterator past the last present key.
+     */
+    [[nodiscard]] inline constexpr auto cend() const -> const_iterator
+    {
+        return end();
+    }
+
+    /**
+     *  @brief  Get the reverse iterator to the last present key.
+     *  @return  Reverse iterator to the last present key.
+     */
+    [[nodiscard]] inline constexpr auto rbegin() -> reverse_iterator
+    {
+        return reverse_iterator(end());
+    }
+
+    /**
+     *  @brief  Get the reverse iterator to the last present key.
+     *  @return  Reverse iterator to the last present key.
+     */
+    [[nodiscard]] inline constexpr auto rbegin() const
+    -> const_reverse_iterator
+    {
+        return const_reverse_iterator(end());
+    }
+
+    /**
+     *  @brief  Get the reverse iterator before the first present key.
+     *  @return  Reverse iterator before the first present key.
+     */
+    [[nodiscard]] inline constexpr auto rend() -> reverse_iterator
+    {
+        return reverse_iterator(begin());
+    }
+
+    /**
+     *  @brief  Get the reverse iterator before the first present key.
+     *  @return  Reverse iterator before the first present key.
+     */
+    [[nodiscard]] inline constexpr auto rend() const
+    -> const_reverse_iterator
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    /**
+     *  @brief  Get the constant reverse iterator to the last present key.
+     *  @return  Constant reverse iterator to the last present key.
+     */
+    [[nodiscard]] inline constexpr auto crbegin() const
+    -> const_reverse_iterator
+    {
+        return rbegin();
+    }
+
+    /**
+     *  @brief  Get the constant reverse iterator before the first present
+     *          key.
+     *  @return  Constant reverse iterator before the first present key.
+     */
+    [[nodiscard]] inline constexpr auto crend() const
+    -> const_reverse_iterator
+    {
+        return rend();
+    }
+
+    /**
+     *  @brief  Check if two maps are equal.
+     *
+     *  @param  a  The first map.
+     *  @param  b  The second map.
+     *  @return  True if both have the same keys with equal elements.
+     */
+    [[nodiscard]] friend inline constexpr auto operator== (
+        const enumerated_optional_map &a,
+        const enumerated_optional_map &b
+    ) -> bool
+    {
+        if (a.present != b.present) return false;
+        for (auto key : a.present)
+        {
+            if (!(a.values[key] == b.values[key])) return false;
+        }
+        return true;
+    }
+};
+
+/**
+ *  @brief  Sequence of pieces of elements stored contiguously.
+ *
+ *  All the elements of all the pieces live in one buffer, and the pieces are
+ *  delimited by an array of offsets into the buffer, like the compressed sparse
+ *  row format.  This is a compact alternative to @c result_container_nested ,
+ *  which allocates separately for each piece.
+ *
+ *  @tparam  T      The type of element.
+ *  @tparam  Alloc  The allocator type of elements.
+ */
+template<typename T, typename Alloc = std::allocator<T>>
+struct jagged {
+
+    /**
+     *  @brief  Type of piece.
+     */
+    using value_type = std::span<const T>;
+
+    /**
+     *  @brief  Type of element of piece.
+     */
+    using element_type = T;
+
+    /**
+     *  @brief  Size type.
+     */
+    using size_type = std::size_t;
+
+    /**
+     *  @brief  Difference type.
+     */
+    using difference_type = std::ptrdiff_t;
+
+    /**
+     *  @brief  Allocator type of elements.
+     */
+    using allocator_type = Alloc;
+
+    /**
+     *  @brief  Allocator type of offsets.
+     */
+    using offsets_allocator_type = std::allocator_traits<Alloc>
+        ::template rebind_alloc<std::size_t>;
+
+    /**
+     *  @brief  All the elements of all the pieces.
+     */
+    std::vector<T, Alloc> values = {};
+
+    /**
+     *  @brief  Offsets of pieces into the values, the piece @c i is
+     *          @c [offsets[i], @c offsets[i+1]) .
+     */
+    std::vector<std::size_t, offsets_allocator_type> offsets = { 0 };
+
+    /**
+     *  @brief  Random access iterator to iterate over each piece.
+     */
+    struct iterator {
+
+        /**
+         *  @brief  Iterator concept.
+         */
+        using iterator_concept = std::random_access_iterator_tag;
+
+        /**
+         *  @brief  Iterator category.
+         */
+        using iterator_category = std::input_iterator_tag;
+
+        /**
+         *  @brief  Iterator value type.
+         */
+        using value_type = std::span<const T>;
+
+        /**
+         *  @brief  Iterator difference type.
+         */
+        using difference_type = std::ptrdiff_t;
+
+        /**
+         *  @brief  The jagged this iterator belongs to.
+         */
+        const jagged *parent = nullptr;
+
+        /**
+         *  @brief  Index of the current piece.
+         */
+        std::size_t index = 0;
+
+        /**
+         *  @brief  Get the current piece.
+         *  @return  Current piece.
+         */
+        [[nodiscard]] inline constexpr auto operator* () const
+        {
+            return (*parent)[index];
+        }
+
+        /**
+         *  @brief  Get the piece relative to current piece.
+         *
+         *  @param  n  The distance to the piece.
+         *  @return  The piece.
+         */
+        [[nodiscard]] inline constexpr auto operator[] (difference_type n) const
+        {
+            return (*parent)[index + n];
+        }
+
+        /**
+         *  @brief  Advance to the next piece.
+         *  @return  Reference to self.
+         */
+        inline constexpr auto operator++ () -> iterator &
+        {
+            index++;
+            return *this;
+        }
+
+        /**
+         *  @brief  Advance to the next piece.
+         *  @return  Copy of self before advancing.
+         */
+        inline constexpr auto operator++ (int) -> iterator
+        {
+            auto copy = *this;
+            index++;
+            return copy;
+        }
+
+        /**
+         *  @brief  Go back to the previous piece.
+         *  @return  Reference to self.
+         */
+        inline constexpr auto operator-- () -> iterator &
+        {
+            index--;
+            return *this;
+        }
+
+        /**
+         *  @brief  Go back to the previous piece.
+         *  @return  Copy of self before going back.
+         */
+        inline constexpr auto operator-- (int) -> iterator
+        {
+            auto copy = *this;
+            index--;
+            return copy;
+        }
+
+        /**
+         *  @brief  Advance by @c n pieces.
+         *
+         *  @param  n  The number of pieces.
+         *  @return  Reference to self.
+         */
+        inline constexpr auto operator+= (difference_type n) -> iterator &
+        {
+            index += n;
+            return *this;
+        }
+
+        /**
+         *  @brief  Go back by @c n pieces.
+         *
+         *  @param  n  The number of pieces.
+         *  @return  Reference to self.
+         */
+        inline constexpr auto operator-= (difference_type n) -> iterator &
+        {
+            index -= n;
+            return *this;
+        }
+
+        /**
+         *  @brief  Get the iterator advanced by @c n pieces.
+         *
+         *  @param  it  An iterator.
+         *  @param  n   The number of pieces.
+         *  @return  Advanced iterator.
+         */
+        [[nodiscard]] friend inline constexpr auto operator+ (
+            iterator        it,
+            difference_type n
+        ) -> iterator
+        {
+            return it += n;
+        }
+
+        /**
+         *  @brief  Get the iterator advanced by @c n pieces.
+         *
+         *  @param  n   The number of pieces.
+         *  @param  it  An iterator.
+         *  @return  Advanced iterator.
+         */
+        [[nodiscard]] friend inline constexpr auto operator+ (
+            difference_type n,
+            iterator        it
+        ) -> iterator
+        {
+            return it += n;
+        }
+
+        /**
+         *  @brief  Get the iterator gone back by @c n pieces.
+         *
+         *  @param  it  An iterator.
+         *  @param  n   The number of pieces.
+         *  @return  Gone back iterator.
+         */
+        [[nodiscard]] friend inline constexpr auto operator- (
+            iterator        it,
+            difference_type n
+        ) -> iterator
+        {
+            return it -= n;
+        }
+
+        /**
+         *  @brief  Get the distance between two iterators.
+         *
+         *  @param  a  The first iterator.
+         *  @param  b  The second iterator.
+         *  @return  The number of pieces from @c b to @c a .
+         */
+        [[nodiscard]] friend inline constexpr auto operator- (
+            const iterator &a,
+            const iterator &b
+        ) -> difference_type
+        {
+            return (difference_type)a.index - (difference_type)b.index;
+        }
+
+        /**
+         *  @brief  Compare two iterators.
+         *
+         *  @param  a  The first iterator.
+         *  @param  b  The second iterator.
+         *  @return  True if both are at the same piece.
+         */
+        [[nodiscard]] friend inline constexpr auto operator== (
+            const iterator &a,
+            const iterator &b
+        ) -> bool
+        {
+            return a.index == b.index;
+        }
+
+        /**
+         *  @brief  Order two iterators.
+         *
+         *  @param  a  The first iterator.
+         *  @param  b  The second iterator.
+         *  @return  Ordering of the pieces of both.
+         */
+        [[nodiscard]] friend inline constexpr auto operator<=> (
+            const iterator &a,
+            const iterator &b
+        )
+        {
+            return a.index <=> b.index;
+        }
+    };
+
+    /**
+     *  @brief  Creates an empty jagged.
+     */
+    inline constexpr jagged() = default;
+
+    /**
+     *  @brief  Creates an empty jagged with allocator.
+     *  @param  allocator  The allocator.
+     */
+    explicit inline constexpr jagged(const Alloc &allocator)
+        : values(allocator),
+          offsets({ 0 }, offsets_allocator_type(allocator)) {}
+
+    /**
+     *  @brief  Get the number of pieces.
+     *  @return  The number of pieces.
+     */
+    [[nodiscard]] inline constexpr auto size() const
+    {
+        return offsets.size() - 1;
+    }
+
+    /**
+     *  @brief  Check if there are no pieces.
+     *  @return  True if there are no pieces.
+     */
+    [[nodiscard]] inline constexpr auto empty() const
+    {
+        return offsets.size() == 1;
+    }
+
+    /**
+     *  @brief  Get the allocator of elements.
+     *  @return  The allocator of elements.
+     */
+    [[nodiscard]] inline constexpr auto get_allocator() const
+    {
+        return values.get_allocator();
+    }
+
+    /**
+     *  @brief  Get the piece at index.
+     *
+     *  @param  index  The index of the piece.
+     *  @return  The piece.
+     */
+    [[nodiscard]] inline constexpr auto operator[] (std::size_t index) const
+    {
+        return std::span<const T>(values.data() + offsets[index],
+            offsets[index + 1] - offsets[index]);
+    }
+
+    /**
+     *  @brief  Get the first piece.
+     *  @return  The first piece.
+     */
+    [[nodiscard]] inline constexpr auto front() const
+    {
+        return (*this)[0];
+    }
+
+    /**
+     *  @brief  Get the last piece.
+     *  @return  The last piece.
+     */
+    [[nodiscard]] inline constexpr auto back() const
+    {
+        return (*this)[size() - 1];
+    }
+
+    /**
+     *  @brief  Get the iterator to the first piece.
+     *  @return  Iterator to the first piece.
+     */
+    [[nodiscard]] inline constexpr auto begin() const
+    {
+        return iterator { this, 0 };
+    }
+
+    /**
+     *  @brief  Get the iterator past the last piece.
+     *  @return  Iterator past the last piece.
+     */
+    [[nodiscard]] inline constexpr auto end() const
+    {
+        return iterator { this, size() };
+    }
+
+    /**
+     *  @brief  Reserve the storage.
+     *
+     *  @param  pieces    The number of pieces to reserve for.
+     *  @param  elements  The number of elements to reserve for.
+     */
+    inline constexpr auto reserve(
+        std::size_t pieces,
+        std::size_t elements = 0
+    ) -> void
+    {
+        offsets.reserve(pieces + 1);
+        values.reserve(elements);
+    }
+
+    /**
+     *  @brief  Append a piece.
+     *
+     *  @tparam  Range  An input range type of elements.
+     *  @param   piece  The elements of the piece.
+     */
+    template<std::ranges::input_range Range>
+    requires(std::is_convertible_v<std::ranges::range_reference_t<Range>, T>)
+    inline constexpr auto push_back(Range &&piece) -> void
+    {
+        values.insert(values.end(), std::ranges::begin(piece),
+            std::ranges::end(piece));
+        offsets.emplace_back(values.size());
+    }
+
+    /**
+     *  @brief  Remove all the pieces.
+     */
+    inline constexpr auto clear() -> void
+    {
+        values.clear();
+        offsets.resize(1);
+    }
+
+    /**
+     *  @brief  Convert to nested container.
+     *  @return  Copy of pieces as @c std::vector of @c std::vector .
+     */
+    [[nodiscard]] inline constexpr auto to_nested() const
+    {
+        std::vector<std::vector<T>> nested;
+        nested.reserve(size());
+        for (auto piece : *this)
+        {
+            nested.emplace_back(piece.begin(), piece.end());
+        }
+        return nested;
+    }
+
+    /**
+     *  @brief  Compare two jagged.
+     *
+     *  @param  a  The first jagged.
+     *  @param  b  The second jagged.
+     *  @return  True if both have the same pieces.
+     */
+    [[nodiscard]] friend inline constexpr auto operator== (
+        const jagged &a,
+        const jagged &b
+    ) -> bool
+    {
+        return std::ranges::equal(a.values, b.values)
+            && std::ranges::equal(a.offsets, b.offsets);
+    }
+};
+
+/**
+ *  @brief  Vector storing up to @c N elements inline, and the rest on the
+ *          heap.
+ *
+ *  Short results do not allocate at all, the elements move to the heap when
+ *  the size exceeds @c N .  The iterators are pointers, so it is compatible for
+ *  Container Utilities, and it can be the @c Result of the algorithms.
+ *  Moving a small vector with inline elements moves the elements.
+ *
+ *  @tparam  T      The type of element.
+ *  @tparam  N      The number of elements stored inline.
+ *  @tparam  Alloc  Allocator type, defaults to @c std::allocator<T> .
+ */
+template<typename T, std::size_t N, typename Alloc = std::allocator<T>>
+requires(N > 0)
+struct small_vector {
+
+    /**
+     *  @brief  Type of element.
+     */
+    using value_type = T;
+
+    /**
+     *  @brief  Allocator type of elements on the heap.
+     */
+    using allocator_type = Alloc;
+
+    /**
+     *  @brief  Size type.
+     */
+    using size_type = std::size_t;
+
+    /**
+     *  @brief  Difference type.
+     */
+    using difference_type = std::ptrdiff_t;
+
+    /**
+     *  @brief  Reference type.
+     */
+    using reference = T &;
+
+    /**
+     *  @brief  Constant reference type.
+     */
+    using const_reference = const T &;
+
+    /**
+     *  @brief  Pointer type.
+     */
+    using pointer = T *;
+
+    /**
+     *  @brief  Constant pointer type.
+     */
+    using const_pointer = const T *;
+
+    /**
+     *  @brief  Contiguous iterator type.
+     */
+    using iterator = T *;
+
+    /**
+     *  @brief  Constant contiguous iterator type.
+     */
+    using const_iterator = const T *;
+
+    /**
+     *  @brief  Reverse iterator type.
+     */
+    using reverse_iterator = std::reverse_iterator<iterator>;
+
+    /**
+     *  @brief  Constant reverse iterator type.
+     */
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    /**
+     *  @brief  Allocator traits of the allocator.
+     */
+    using traits = std::allocator_traits<Alloc>;
+
+    /**
+     *  @brief  Inline storage, the elements are constructed by the vector.
+     */
+    union storage {
+
+        /**
+         *  @brief  Inline elements.
+         */
+        T elements[N];
+
+        /**
+         *  @brief  Creates storage without constructing the elements.
+         */
+        inline constexpr storage() {}
+
+        /**
+         *  @brief  Destroys storage without destroying the elements.
+         */
+        inline constexpr ~storage() {}
+    };
+
+    /**
+     *  @brief  The inline storage.
+     */
+    storage inline_storage;
+
+    /**
+     *  @brief  Elements on the heap, or null if the elements are inline.
+     */
+    T *heap = nullptr;
+
+    /**
+     *  @brief  The number of elements.
+     */
+    size_type count = 0;
+
+    /**
+     *  @brief  The number of elements that fit without reallocating.
+     */
+    size_type allocated = N;
+
+    /**
+     *  @brief  The allocator of elements on the heap.
+     */
+    [[no_unique_address]] Alloc allocator = {};
+
+    /**
+     *  @brief  Creates a vector with no elements.
+     */
+    inline constexpr small_vector() = default;
+
+    /**
+     *  @brief  Creates a vector with no elements.
+     *  @param  alloc  The allocator of elements on the heap.
+     */
+    inline constexpr explicit small_vector(const Alloc &alloc)
+        : allocator(alloc)
+    {}
+
+    /**
+     *  @brief  Creates a vector with @c size default constructed elements.
+     *
+     *  @param  size   The number of elements.
+     *  @param  alloc  The allocator of elements on the heap.
+     */
+    inline constexpr explicit small_vector(
+        size_type    size,
+        const Alloc &alloc = Alloc()
+    ) : allocator(alloc)
+    {
+        try
+        {
+            resize(size);
+        }
+        catch (...)
+        {
+            clear();
+            release();
+            throw;
+        }
+    }
+
+    /**
+     *  @brief  Creates a vector with @c size copies of value.
+     *
+     *  @param  size   The number of elements.
+     *  @param  value  The value to copy.
+     *  @param  alloc  The allocator of elements on the heap.
+     */
+    inline constexpr small_vector(
+        size_type    size,
+        const T     &value,
+        const Alloc &alloc = Alloc()
+    ) : allocator(alloc)
+    {
+        try
+        {
+            resize(size, value);
+        }
+        catch (...)
+        {
+            clear();
+            release();
+            throw;
+        }
+    }
+
+    /**
+     *  @brief  Creates a vector with the elements of range.
+     *
+     *  @tparam  Iterator  An input iterator type.
+     *  @param   first     The first element.
+     *  @param   last      The end of elements.
+     *  @param   alloc     The allocator of elements on the heap.
+     */
+    template<std::input_iterator Iterator>
+    inline constexpr small_vector(
+        Iterator     first,
+        Iterator     last,
+        const Alloc &alloc = Alloc()
+    ) : allocator(alloc)
+    {
+        try
+        {
+            insert(end(), first, last);
+        }
+        catch (...)
+        {
+            clear();
+            release();
+            throw;
+        }
+    }
+
+    /**
+     *  @brief  Creates a vector with the elements of list.
+     *
+     *  @param  list   The elements.
+     *  @param  alloc  The allocator of elements on the heap.
+     */
+    inline constexpr small_vector(
+        std::initializer_list<T> list,
+        const Alloc             &alloc = Alloc()
+    ) : allocator(alloc)
+    {
+        try
+        {
+            insert(end(), list.begin(), list.end());
+        }
+        catch (...)
+        {
+            clear();
+            release();
+            throw;
+        }
+    }
+
+    /**
+     *  @brief  Copy a vector.
+     *  @param  other  The vector to copy.
+     */
+    inline constexpr small_vector(const small_vector &other)
+        : allocator(traits::select_on_container_copy_construction(
+              other.allocator))
+    {
+        try
+        {
+            insert(end(), other.begin(), other.end());
+        }
+        catch (...)
+        {
+            clear();
+            release();
+            throw;
+        }
+    }
+
+    /**
+     *  @brief  Move a vector, taking over its heap storage.
+     *  @param  other  The vector to move.
+     */
+    inline constexpr small_vector(small_vector &&other) noexcept(
+        std::is_nothrow_move_constructible_v<T>)
+        : allocator(std::move(other.allocator))
+    {
+        take(other);
+    }
+
+    /**
+     *  @brief  Destroy the elements and free the heap storage.
+     */
+    inline constexpr ~small_vector()
+    {
+        clear();
+        release();
+    }
+
+    /**
+     *  @brief  Copy a vector.
+     *
+     *  @param  other  The vector to copy.
+     *  @return  Reference to self.
+     */
+    inline constexpr auto operator= (const small_vector &other)
+    -> small_vector &
+    {
+        if (this == &other) return *this;
+
+        if constexpr (traits::propagate_on_container_copy_assignment::value)
+        {
+            if (allocator != other.allocator)
+            {
+                // Heap storage must be freed by the allocator that made it
+                clear();
+                release();
+            }
+            allocator = other.allocator;
+        }
+
+        assign(other.begin(), other.end());
+        return *this;
+    }
+
+    /**
+     *  @brief  Move a vector, taking over its heap storage.
+     *
+     *  @param  other  The vector to move.
+     *  @return  Reference to self.
+     */
+    inline constexpr auto operator= (small_vector &&other) noexcept(
+        (traits::propagate_on_container_move_assignment::value
+      || traits::is_always_equal::value)
+     && std::is_nothrow_move_constructible_v<T>) -> small_vector &
+    {
+        if (this == &other) return *this;
+
+        clear();
+        if constexpr (traits::propagate_on_container_move_assignment::value)
+        {
+            // Free with the old allocator, then take over with the new one
+            release();
+            allocator = std::move(other.allocator);
+            take(other);
+            return *this;
+        }
+
+        if (other.heap && allocator != other.allocator)
+        {
+            // Heap storage of another allocator cannot be taken over
+            reserve(other.count);
+            for (auto &element : other)
+            {
+                traits::construct(allocator, data() + count,
+                    std::move(element));
+                count++;
+            }
+            other.clear();
+            return *this;
+        }
+
+        release();
+        take(other);
+        return *this;
+    }
+
+    /**
+     *  @brief  Replace the elements with a list.
+     *
+     *  @param  list  The elements.
+     *  @return  Reference to self.
+     */
+    inline constexpr auto operator= (std::initializer_list<T> list)
+    -> small_vector &
+    {
+        assign(list.begin(), list.end());
+        return *this;
+    }
+
+    /**
+     *  @brief  Take over the elements of another vector, which must be empty
+     *          with no heap storage.
+     *  @param  other  The vector to take from.
+     */
+    inline constexpr auto take(small_vector &other) -> void
+    {
+        if (other.heap)
+        {
+            heap      = std::exchange(other.heap, nullptr);
+            count     = std::exchange(other.count, 0);
+            allocated = std::exchange(other.allocated, N);
+            return;
+        }
+
+        for (auto &element : other)
+        {
+            traits::construct(allocator, data() + count, std::move(element));
+            count++;
+        }
+        other.clear();
+    }
+
+    /**
+     *  @brief  Free the heap storage, the elements must be destroyed.
+     */
+    inline constexpr auto release() -> void
+    {
+        if (heap) traits::deallocate(allocator, heap, allocated);
+        heap      = nullptr;
+        allocated = N;
+    }
+
+    /**
+     *  @brief  Get the allocator of elements on the heap.
+     *  @return  The allocator.
+     */
+    [[nodiscard]] inline constexpr auto get_allocator() const -> Alloc
+    {
+        return allocator;
+    }
+
+    /**
+     *  @brief  Get the pointer to the first element.
+     *  @return  Pointer to the first element.
+     */
+    [[nodiscard]] inline constexpr auto data() -> T *
+    {
+        return heap ? heap : inline_storage.elements;
+    }
+
+    /**
+     *  @brief  Get the pointer to the first element.
+     *  @return  Pointer to the first element.
+     */
+    [[nodiscard]] inline constexpr auto data() const -> const T *
+    {
+        return heap ? heap : inline_storage.elements;
+    }
+
+    /**
+     *  @brief  Get the iterator to the first element.
+     *  @return  Iterator to the first element.
+     */
+    [[nodiscard]] inline constexpr auto begin() -> iterator
+    {
+        return data();
+    }
+
+    /**
+     *  @brief  Get the iterator to the first element.
+     *  @return  Iterator to the first element.
+     */
+    [[nodiscard]] inline constexpr auto begin() const -> const_iterator
+    {
+        return data();
+    }
+
+    /**
+     *  @brief  Get the iterator past the last element.
+     *  @return  Iterator past the last element.
+     */
+    [[nodiscard]] inline constexpr auto end() -> iterator
+    {
+        return data() + count;
+    }
+
+    /**
+     *  @brief  Get the iterator past the last element.
+     *  @return  Iterator past the last element.
+     */
+    [[nodiscard]] inline constexpr auto end() const -> const_iterator
+    {
+        return data() + count;
+    }
+
+    /**
+     *  @brief  Get the iterator to the first element.
+     *  @return  Iterator to the first element.
+     */
+    [[nodiscard]] inline constexpr auto cbegin() const -> const_iterator
+    {
+        return begin();
+    }
+
+    /**
+     *  @brief  Get the iterator past the last element.
+     *  @return  Iterator past the last element.
+     */
+    [[nodiscard]] inline constexpr auto cend() const -> const_iterator
+    {
+        return end();
+    }
+
+    /**
+     *  @brief  Get the reverse iterator to the last element.
+     *  @return  Reverse iterator to the last element.
+     */
+    [[nodiscard]] inline constexpr auto rbegin() -> reverse_iterator
+    {
+        return reverse_iterator(end());
+    }
+
+    /**
+     *  @brief  Get the reverse iterator to the last element.
+     *  @return  Reverse iterator to the last element.
+     */
+    [[nodiscard]] inline constexpr auto rbegin() const
+    -> const_reverse_iterator
+    {
+        return const_reverse_iterator(end());
+    }
+
+    /**
+     *  @brief  Get the reverse iterator past the first element.
+     *  @return  Reverse iterator past the first element.
+     */
+    [[nodiscard]] inline constexpr auto rend() -> reverse_iterator
+    {
+        return reverse_iterator(begin());
+    }
+
+    /**
+     *  @brief  Get the reverse iterator past the first element.
+     *  @return  Reverse iterator past the first element.
+     */
+    [[nodiscard]] inline constexpr auto rend() const -> const_reverse_iterator
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    /**
+     *  @brief  Get the number of elements.
+     *  @return  The number of elements.
+     */
+    [[nodiscard]] inline constexpr auto size() const -> size_type
+    {
+        return count;
+    }
+
+    /**
+     *  @brief  Get the number of elements that fit without reallocating.
+     *  @return  The capacity.
+     */
+    [[nodiscard]] inline constexpr auto capacity() const -> size_type
+    {
+        return allocated;
+    }
+
+    /**
+     *  @brief  Get the maximum number of elements.
+     *  @return  The maximum number of elements.
+     */
+    [[nodiscard]] inline constexpr auto max_size() const -> size_type
+    {
+        return traits::max_size(allocator);
+    }
+
+    /**
+     *  @brief  Check if the vector has no elements.
+     *  @return  True if the vector has no elements.
+     */
+    [[nodiscard]] inline constexpr auto empty() const -> bool
+    {
+        return count == 0;
+    }
+
+    /**
+     *  @brief  Check if the elements are stored inline.
+     *  @return  True if the elements are not on the heap.
+     */
+    [[nodiscard]] inline constexpr auto is_inline() const -> bool
+    {
+        return heap == nullptr;
+    }
+
+    /**
+     *  @brief  Access element at index without bounds checking.
+     *
+     *  @param  index  An index specifying element.
+     *  @return  Element at index.
+     */
+    [[nodiscard]] inline constexpr auto operator[] (size_type index)
+    -> T &
+    {
+        return data()[index];
+    }
+
+    /**
+     *  @brief  Access element at index without bounds checking.
+     *
+     *  @param  index  An index specifying element.
+     *  @return  Element at index.
+     */
+    [[nodiscard]] inline constexpr auto operator[] (size_type index) const
+    -> const T &
+    {
+        return data()[index];
+    }
+
+    /**
+     *  @brief  Access the first element.
+     *  @return  The first element.
+     */
+    [[nodiscard]] inline constexpr auto front() -> T &
+    {
+        return data()[0];
+    }
+
+    /**
+     *  @brief  Access the first element.
+     *  @return  The first element.
+     */
+    [[nodiscard]] inline constexpr auto front() const -> const T &
+    {
+        return data()[0];
+    }
+
+    /**
+     *  @brief  Access the last element.
+     *  @return  The last element.
+     */
+    [[nodiscard]] inline constexpr auto back() -> T &
+    {
+        return data()[count - 1];
+    }
+
+    /**
+     *  @brief  Access the last element.
+     *  @return  The last element.
+     */
+    [[nodiscard]] inline constexpr auto back() const -> const T &
+    {
+        return data()[count - 1];
+    }
+
+    /**
+     *  @brief  Move the elements to storage for at least @c capacity
+     *          elements.
+     *  @param  capacity  The number of elements to reserve for.
+     */
+    inline constexpr auto reserve(size_type capacity) -> void
+    {
+        if (capacity <= allocated) return;
+
+        T        *buffer = traits::allocate(allocator, capacity);
+        size_type built  = 0;
+
+        // Elements are only destroyed once all of them are in the buffer, so
+        // a throwing copy leaves the vector unchanged
+        try
+        {
+            for (; built < count; built++)
+            {
+                traits::construct(allocator, buffer + built,
+                    std::move_if_noexcept(data()[built]));
+            }
+        }
+        catch (...)
+        {
+            for (size_type i = 0; i < built; i++)
+            {
+                traits::destroy(allocator, buffer + i);
+            }
+            traits::deallocate(allocator, buffer, capacity);
+            throw;
+        }
+
+        for (size_type i = 0; i < count; i++)
+        {
+            traits::destroy(allocator, data() + i);
+        }
+
+        release();
+        heap      = buffer;
+        allocated = capacity;
+    }
+
+    /**
+     *  @brief  Append an element constructed from arguments.
+     *
+     *  @tparam  Args  The types of arguments.
+     *  @param   args  The arguments to construct the element with.
+     *  @return  Reference to the appended element.
+     */
+    template<typename... Args>
+    inline constexpr auto emplace_back(Args &&...args) -> T &
+    {
+        if (count == allocated)
+        {
+            // Arguments may refer to elements that are about to move
+            T element(std::forward<Args>(args)...);
+            reserve(std::max(allocated * 2, count + 1));
+            traits::construct(allocator, data() + count, std::move(element));
+        }
+        else
+        {
+            traits::construct(allocator, data() + count,
+                std::forward<Args>(args)...);
+        }
+        return data()[count++];
+    }
+
+    /**
+     *  @brief  Append a copy of value.
+     *  @param  value  The value to append.
+     */
+    inline constexpr auto push_back(const T &value) -> void
+    {
+        emplace_back(value);
+    }
+
+    /**
+     *  @brief  Append value.
+     *  @param  value  The value to append.
+     */
+    inline constexpr auto push_back(T &&value) -> void
+    {
+        emplace_back(std::move(value));
+    }
+
+    /**
+     *  @brief  Remove the last element.
+     */
+    inline constexpr auto pop_back() -> void
+    {
+        traits::destroy(allocator, data() + --count);
+    }
+
+    /**
+     *  @brief  Insert the elements of range before position.
+     *
+     *  The elements are appended and rotated into place.
+     *
+     *  @tparam  Iterator  An input iterator type.
+     *  @param   position  The position to insert at.
+     *  @param   first     The first element.
+     *  @param   last      The end of elements.
+     *  @return  Iterator to the first inserted element.
+     */
+    template<std::input_iterator Iterator>
+    inline constexpr auto insert(
+        const_iterator position,
+        Iterator       first,
+        Iterator       last
+    ) -> iterator
+    {
+        size_type index = position - begin();
+        size_type old   = count;
+
+        if constexpr (std::forward_iterator<Iterator>)
+        {
+            reserve(count + (size_type)std::distance(first, last));
+        }
+        for (; first != last; ++first) emplace_back(*first);
+
+        std::rotate(begin() + index, begin() + old, end());
+        return begin() + index;
+    }
+
+    /**
+     *  @brief  Insert the elements of list before position.
+     *
+     *  @param  position  The position to insert at.
+     *  @param  list      The elements.
+     *  @return  Iterator to the first inserted element.
+     */
+    inline constexpr auto insert(
+        const_iterator           position,
+        std::initializer_list<T> list
+    ) -> iterator
+    {
+        return insert(position, list.begin(), list.end());
+    }
+
+    /**
+     *  @brief  Insert an element constructed from arguments before position.
+     *
+     *  @tparam  Args      The types of arguments.
+     *  @param   position  The position to insert at.
+     *  @param   args      The arguments to construct the element with.
+     *  @return  Iterator to the inserted element.
+     */
+    template<typename... Args>
+    inline constexpr auto emplace(
+        const_iterator position,
+        Args       &&...args
+    ) -> iterator
+    {
+        size_type index = position - begin();
+        emplace_back(std::forward<Args>(args)...);
+        std::rotate(begin() + index, end() - 1, end());
+        return begin() + index;
+    }
+
+    /**
+     *  @brief  Insert a copy of value before position.
+     *
+     *  @param  position  The position to insert at.
+     *  @param  value     The value to insert.
+     *  @return  Iterator to the inserted element.
+     */
+    inline constexpr auto insert(
+        const_iterator position,
+        const T       &value
+    ) -> iterator
+    {
+        return emplace(position, value);
+    }
+
+    /**
+     *  @brief  Insert value before position.
+     *
+     *  @param  position  The position to insert at.
+     *  @param  value     The value to insert.
+     *  @return  Iterator to the inserted element.
+     */
+    inline constexpr auto insert(
+        const_iterator position,
+        T            &&value
+    ) -> iterator
+    {
+        return emplace(position, std::move(value));
+    }
+
+    /**
+     *  @brief  Remove the elements of range.
+     *
+     *  @param  first  The first element to remove.
+     *  @param  last   The end of elements to remove.
+     *  @return  Iterator to the element after the removed elements.
+     */
+    inline constexpr auto erase(
+        const_iterator first,
+        const_iterator last
+    ) -> iterator
+    {
+        iterator output = begin() + (first - begin());
+        iterator input  = begin() + (last - begin());
+
+        iterator new_end = std::move(input, end(), output);
+        while (end() != new_end) pop_back();
+        return output;
+    }
+
+    /**
+     *  @brief  Remove the element at position.
+     *
+     *  @param  position  The element to remove.
+     *  @return  Iterator to the element after the removed element.
+     */
+    inline constexpr auto erase(const_iterator position) -> iterator
+    {
+        return erase(position, position + 1);
+    }
+
+    /**
+     *  @brief  Replace the elements with the elements of range.
+     *
+     *  @tparam  Iterator  An input iterator type.
+     *  @param   first     The first element.
+     *  @param   last      The end of elements.
+     */
+    template<std::input_iterator Iterator>
+    inline constexpr auto assign(Iterator first, Iterator last) -> void
+    {
+        clear();
+        insert(end(), first, last);
+    }
+
+    /**
+     *  @brief  Replace the elements with @c size copies of value.
+     *
+     *  @param  size   The number of elements.
+     *  @param  value  The value to copy.
+     */
+    inline constexpr auto assign(size_type size, const T &value) -> void
+    {
+        clear();
+        resize(size, value);
+    }
+
+    /**
+     *  @brief  Resize to @c size elements, appending default constructed
+     *          elements.
+     *
+     *  @param  size  The number of elements.
+     */
+    inline constexpr auto resize(size_type size) -> void
+    {
+        while (count > size) pop_back();
+        reserve(size);
+        while (count < size) emplace_back();
+    }
+
+    /**
+     *  @brief  Resize to @c size elements, appending copies of value.
+     *
+     *  @param  size   The number of elements.
+     *  @param  value  The value to copy.
+     */
+    inline constexpr auto resize(size_type size, const T &value) -> void
+    {
+        while (count > size) pop_back();
+        reserve(size);
+        while (count < size) emplace_back(value);
+    }
+
+    /**
+     *  @brief  Remove all the elements, keeping the storage.
+     */
+    inline constexpr auto clear() -> void
+    {
+        while (count > 0) pop_back();
+    }
+
+    /**
+     *  @brief  Compare two vectors.
+     *
+     *  @param  a  The first vector.
+     *  @param  b  The second vector.
+     *  @return  True if both have equal elements.
+     */
+    [[nodiscard]] friend inline constexpr auto operator== (
+        const small_vector &a,
+        const small_vector &b
+    ) -> bool
+    {
+        return std::ranges::equal(a, b);
+    }
+
+    /**
+     *  @brief  Compare two vectors lexicographically.
+     *
+     *  @param  a  The first vector.
+     *  @param  b  The second vector.
+     *  @return  Ordering of the first vector to the second.
+     */
+    [[nodiscard]] friend inline constexpr auto operator<=> (
+        const small_vector &a,
+        const small_vector &b
+    )
+    requires(std::three_way_comparable<T>)
+    {
+        return std::lexicographical_compare_three_way(a.begin(), a.end(),
+            b.begin(), b.end());
+    }
+};
+
+/**
+ *  @brief  Get a span of constant elements of the container.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @param   container  A container.
+ *  @return  @c std::span viewing all the elements of the container.
+ */
+template<cu_compatible Container>
+[[nodiscard]] inline constexpr auto as_span(const Container &container)
+{
+    return std::span<const value_type<Container>>(
+        std::to_address(container.begin()),
+        std::to_address(container.end()));
+}
+
+/**
+ *  @brief  Compiled patterns to find the occurrences of any of them in a
+ *          single pass.
+ *
+ *  The patterns are compiled into an Aho-Corasick automaton once, and it can be
+ *  reused for any number of searches.  The matches are leftmost-longest, i.e.,
+ *  the match that starts first wins, and the longest pattern wins among the
+ *  matches that start at the same element.  Empty patterns are ignored.
+ *
+ *  @tparam  Container  A compatible container type of pattern.
+ */
+template<cu_compatible Container>
+struct multi_searcher {
+
+    /**
+     *  @brief  The type of element.
+     */
+    using element_type = value_type<Container>;
+
+    /**
+     *  @brief  Container ending with one of patterns does not end with an
+     *          empty piece.
+     */
+    static constexpr bool trailing_empty = false;
+
+    /**
+     *  @brief  State of the automaton.
+     */
+    struct state {
+
+        /**
+         *  @brief  Transitions to the next states, sorted by element when the
+         *          elements are ordered.
+         */
+        std::vector<std::pair<element_type, std::size_t>> edges = {};
+
+        /**
+         *  @brief  The state of the longest proper suffix that is also a
+         *          prefix of a pattern.
+         */
+        std::size_t failure = 0;
+
+        /**
+         *  @brief  Size of the longest pattern ending at this state, zero if
+         *          none.
+         */
+        std::size_t output = 0;
+    };
+
+    /**
+     *  @brief  States of the automaton, the first is the root.
+     */
+    std::vector<state> states = { state {} };
+
+    /**
+     *  @brief  Size of the longest pattern.
+     */
+    std::size_t longest = 0;
+
+    /**
+     *  @brief  Creates a searcher that finds nothing.
+     */
+    inline constexpr multi_searcher() = default;
+
+    /**
+     *  @brief  Compile the patterns.
+     *
+     *  @tparam  NestedContainer  A compatible container type nested container
+     *                            type.
+     *  @param   patterns         The patterns to find.
+     */
+    template<cu_compatible_nested NestedContainer>
+    requires(std::is_same_v<value_type<value_type<NestedContainer>>,
+        element_type>)
+    inline constexpr multi_searcher(const NestedContainer &patterns)
+    {
+        for (auto &pattern : patterns)
+        {
+            insert(pattern);
+        }
+        link();
+    }
+
+    /**
+     *  @brief  Get the transition from state with element.
+     *
+     *  @param  from     The state to transit from.
+     *  @param  element  The element to transit with.
+     *  @return  The next state, or zero if there is no transition.
+     */
+    [[nodiscard]] inline constexpr auto transition(
+        std::size_t         from,
+        const element_type &element
+    ) const -> std::size_t
+    {
+        auto &edges = states[from].edges;
+        if constexpr (std::totally_ordered<element_type>)
+        {
+            auto it = std::ranges::lower_bound(edges, element, {},
+                &std::pair<element_type, std::size_t>::first);
+            return it != edges.end() && it->first == element ? it->second : 0;
+        }
+        else
+        {
+            auto it = std::ranges::find(edges, element,
+                &std::pair<element_type, std::size_t>::first);
+            return it != edges.end() ? it->second : 0;
+        }
+    }
+
+    /**
+     *  @brief  Add a pattern to the trie of the automaton.
+     *
+     *  @tparam  Pattern  A compatible container type of pattern.
+     *  @param   pattern  The pattern to add.
+     */
+    template<cu_compatible Pattern>
+    inline constexpr auto insert(const Pattern &pattern) -> void
+    {
+        if (pattern.begin() == pattern.end()) return;
+
+        std::size_t current = 0;
+        for (auto &element : pattern)
+        {
+            std::size_t next = transition(current, element);
+            if (next == 0)
+            {
+                next = states.size();
+                states.emplace_back();
+
+                auto &edges = states[current].edges;
+                auto  it    = edges.end();
+                if constexpr (std::totally_ordered<element_type>)
+                {
+                    it = std::ranges::lower_bound(edges, element, {},
+                        &std::pair<element_type, std::size_t>::first);
+                }
+                edges.emplace(it, element, next);
+            }
+            current = next;
+        }
+
+        states[current].output = pattern.size();
+        longest = std::max(longest, (std::size_t)pattern.size());
+    }
+
+    /**
+     *  @brief  Link the failure transitions of the trie in breadth-first
+     *          order.
+     */
+    inline constexpr auto link() -> void
+    {
+        std::vector<std::size_t> queue = {};
+        for (auto &[element, next] : states[0].edges)
+        {
+            queue.emplace_back(next);
+        }
+
+        for (std::size_t i = 0; i < queue.size(); i++)
+        {
+            std::size_t current = queue[i];
+            for (auto &[element, next] : states[current].edges)
+            {
+                std::size_t failure = states[current].failure;
+                while (failure != 0 && transition(failure, element) == 0)
+                {
+                    failure = states[failure].failure;
+                }
+                states[next].failure = transition(failure, element);
+
+                // Longer suffix's patterns start earlier, prefer them
+                states[next].output = std::max(states[next].output,
+                    states[states[next].failure].output);
+                queue.emplace_back(next);
+            }
+        }
+    }
+
+    /**
+     *  @brief  Find the leftmost-longest occurrence of any of patterns.
+     *
+     *  @param  first  The first element to search from.
+     *  @param  last   The end of elements.
+     *  @return  Matched elements, or empty span at @c last if not found.
+     */
+    [[nodiscard]] inline constexpr auto find(
+        const element_type *first,
+        const element_type *last
+    ) const -> std::span<const element_type>
+    {
+        auto        match   = std::span<const element_type>(last, 0);
+        std::size_t current = 0;
+
+        // No match starting before the found match can end after this
+        const element_type *limit = last;
+
+        for (auto it = first; it != limit; it++)
+        {
+            while (current != 0 && transition(current, *it) == 0)
+            {
+                current = states[current].failure;
+            }
+            current = transition(current, *it);
+
+            std::size_t size = states[current].output;
+            if (size == 0) continue;
+
+            auto start = it + 1 - size;
+            if (match.empty() || start < match.data()
+             || (start == match.data() && size > match.size()))
+            {
+                match = std::span<const element_type>(start, size);
+                limit = last - start > (std::ptrdiff_t)longest
+                      ? start + longest : last;
+            }
+        }
+
+        return match;
+    }
+};
+
+/**
+ *  @brief  Element type whose values are single bytes.
+ *  @tparam  T  The type of element.
+ */
+template<typename T>
+concept byte_like = std::is_same_v<T, char>
+                 || std::is_same_v<T, signed char>
+                 || std::is_same_v<T, unsigned char>
+                 || std::is_same_v<T, char8_t>
+                 || std::is_same_v<T, std::byte>;
+
+#ifdef AUSPICIOUS_LIBRARY_X86_64_SIMD
+
+namespace impl {
+
+/**
+ *  @brief  Check if the CPU supports AVX2, once.
+ *  @return  True if AVX2 is supported.
+ */
+[[nodiscard]] inline auto has_avx2() -> bool
+{
+    static const bool supported = []
+    {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") != 0;
+    }();
+    return supported;
+}
+
+/**
+ *  @brief  Find the first byte of any of up to 16 values, 16 bytes at a time
+ *          with SSE2.
+ *
+ *  @param  values  The values to find.
+ *  @param  count   The number of values, at most 16.
+ *  @param  first   The first byte to search from.
+ *  @param  last    The end of bytes.
+ *  @return  The matched byte, or the start of the remaining bytes shorter
+ *           than 16 if not found.
+ */
+[[nodiscard]] inline auto byte_set_find_sse2(
+    const unsigned char *values,
+    std::size_t          count,
+    const unsigned char *first,
+    const unsigned char *last
+) -> const unsigned char *
+{
+    __m128i broadcast[16];
+    for (std::size_t i = 0; i < count; i++)
+    {
+        broadcast[i] = _mm_set1_epi8((char)values[i]);
+    }
+
+    for (; last - first >= 16; first += 16)
+    {
+        __m128i block = _mm_loadu_si128((const __m128i *)first);
+        __m128i hits  = _mm_setzero_si128();
+        for (std::size_t i = 0; i < count; i++)
+        {
+            hits = _mm_or_si128(hits, _mm_cmpeq_epi8(block, broadcast[i]));
+        }
+
+        unsigned mask = (unsigned)_mm_movemask_epi8(hits);
+        if (mask != 0) return first + std::countr_zero(mask);
+    }
+    return first;
+}
+
+/**
+ *  @brief  Find the first byte in the set, 32 bytes at a time with AVX2.
+ *
+ *  The set is a 16x16 bit table indexed by the low and high nibbles of the
+ *  byte, split into rows for high nibbles 0-7 and 8-15.
+ *
+ *  @param  low_rows   Bits of high nibbles 0-7, indexed by low nibble.
+ *  @param  high_rows  Bits of high nibbles 8-15, indexed by low nibble.
+ *  @param  first      The first byte to search from.
+ *  @param  last       The end of bytes.
+ *  @return  The matched byte, or the start of the remaining bytes shorter
+ *           than 32 if not found.
+ */
+[[gnu::target("avx2")]] [[nodiscard]] inline auto byte_set_find_avx2(
+    const unsigned char *low_rows,
+    const unsigned char *high_rows,
+    const unsigned char *first,
+    const unsigned char *last
+) -> const unsigned char *
+{
+    const __m256i low_table = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128((const __m128i *)low_rows));
+    const __m256i high_table = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128((const __m128i *)high_rows));
+    const __m256i bit_table = _mm256_setr_epi8(
+        1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128,
+        1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+    const __m256i nibble = _mm256_set1_epi8(0x0f);
+
+    for (; last - first >= 32; first += 32)
+    {
+        __m256i block = _mm256_loadu_si256((const __m256i *)first);
+        __m256i low   = _mm256_and_si256(block, nibble);
+        __m256i high  = _mm256_and_si256(_mm256_srli_epi16(block, 4), nibble);
+
+        // The top bit of the byte selects the row of high nibbles 8-15
+        __m256i row = _mm256_blendv_epi8(
+            _mm256_shuffle_epi8(low_table, low),
+            _mm256_shuffle_epi8(high_table, low), block);
+        __m256i bit  = _mm256_shuffle_epi8(bit_table, high);
+        __m256i hits = _mm256_cmpeq_epi8(_mm256_and_si256(row, bit), bit);
+
+        unsigned mask = (unsigned)_mm256_movemask_epi8(hits);
+        if (mask != 0) return first + std::countr_zero(mask);
+    }
+    return first;
+}
+
+} // namespace impl
+
+#endif
+
+/**
+ *  @brief  Set of byte values to find any of them quickly.
+ *
+ *  Membership is tested with a 256-bit table.  On x86-64 with GCC or Clang,
+ *  @c find scans 32 bytes at a time with AVX2 if the CPU supports it
+ *  (checked at runtime), or 16 bytes at a time with SSE2 for sets of up to
+ *  16 values, and finishes with the table.
+ */
+struct byte_set {
+
+    /**
+     *  @brief  Membership bit of each byte value.
+     */
+    std::array<std::uint64_t, 4> bits = {};
+
+    /**
+     *  @brief  The number of values in the set.
+     */
+    std::size_t count = 0;
+
+    /**
+     *  @brief  The first 16 values inserted, for the SSE2 kernel.
+     */
+    std::array<unsigned char, 16> listed = {};
+
+    /**
+     *  @brief  Bits of high nibbles 0-7 indexed by low nibble, for the AVX2
+     *          kernel.
+     */
+    std::array<unsigned char, 16> low_rows = {};
+
+    /**
+     *  @brief  Bits of high nibbles 8-15 indexed by low nibble, for the AVX2
+     *          kernel.
+     */
+    std::array<unsigned char, 16> high_rows = {};
+
+    /**
+     *  @brief  Construct an empty set.
+     */
+    inline constexpr byte_set() = default;
+
+    /**
+     *  @brief  Construct the set from values.
+     *
+     *  @tparam  Container  A compatible container type of byte-like values.
+     *  @param   values     The values of the set.
+     */
+    template<cu_compatible Container>
+    requires(byte_like<value_type<Container>>)
+    inline constexpr explicit byte_set(const Container &values)
+    {
+        for (const auto &value : values) insert(value);
+    }
+
+    /**
+     *  @brief  Get the byte value of element.
+     *
+     *  @tparam  T      A byte-like type.
+     *  @param   value  The element.
+     *  @return  The byte value.
+     */
+    template<byte_like T>
+    [[nodiscard]] static inline constexpr auto byte(T value) -> unsigned char
+    {
+        return std::bit_cast<unsigned char>(value);
+    }
+
+    /**
+     *  @brief  Insert a value into the set.
+     *
+     *  @tparam  T      A byte-like type.
+     *  @param   value  The value.
+     */
+    template<byte_like T>
+    inline constexpr auto insert(T value)
+    {
+        unsigned char b = byte(value);
+        if (contains(b)) return;
+
+        bits[b / 64] |= (std::uint64_t)1 << (b % 64);
+        if (count < listed.size()) listed[count] = b;
+        count++;
+
+        auto &rows = b < 128 ? low_rows : high_rows;
+        rows[b & 15] |= (unsigned char)(1 << ((b >> 4) & 7));
+    }
+
+    /**
+     *  @brief  Check if the value is in the set.
+     *
+     *  @tparam  T      A byte-like type.
+     *  @param   value  The value.
+     *  @return  True if the value is in the set.
+     */
+    template<byte_like T>
+    [[nodiscard]] inline constexpr auto contains(T value) const -> bool
+    {
+        unsigned char b = byte(value);
+        return (bits[b / 64] >> (b % 64)) & 1;
+    }
+
+    /**
+     *  @brief  Find the first element in the set.
+     *
+     *  @tparam  T      A byte-like type.
+     *  @param   first  The first element to search from.
+     *  @param   last   The end of elements.
+     *  @return  The matched element, or @c last if not found.
+     */
+    template<byte_like T>
+    [[nodiscard]] inline constexpr auto find(
+        const T *first,
+        const T *last
+    ) const -> const T *
+    {
+        if (count == 0 || first == last) return last;
+
+        if !consteval
+        {
+            if (count == 1)
+            {
+                auto found = std::memchr(first, (int)listed[0],
+                    (std::size_t)(last - first));
+                return found ? (const T *)found : last;
+            }
+
+#ifdef AUSPICIOUS_LIBRARY_X86_64_SIMD
+            auto begin = (const unsigned char *)first;
+            auto end   = (const unsigned char *)last;
+            auto found = begin;
+
+            if (impl::has_avx2())
+            {
+                found = impl::byte_set_find_avx2(low_rows.data(),
+                    high_rows.data(), begin, end);
+            }
+            else if (count <= listed.size())
+            {
+                found = impl::byte_set_find_sse2(listed.data(), count, begin,
+                    end);
+            }
+
+            // Either the match, or the remaining bytes to check
+            first += found - begin;
+#endif
+        }
+
+        while (first != last && !contains(*first)) first++;
+        return first;
+    }
+};
+
+/**
+ *  @brief  Compiled pattern to find its occurrences repeatedly.
+ *
+ *  The tables are computed once from the pattern, and it can be reused for any
+ *  number of searches.  Single element patterns are found with @c std::memchr
+ *  (or @c std::find ), byte-like elements use Boyer-Moore-Horspool and other
+ *  elements use Knuth-Morris-Pratt.
+ *
+ *  @tparam  Container  A compatible container type of pattern.
+ */
+template<cu_compatible Container>
+struct searcher {
+
+    /**
+     *  @brief  The type of element.
+     */
+    using element_type = value_type<Container>;
+
+    /**
+     *  @brief  Container ending with the pattern ends with an empty piece.
+     */
+    static constexpr bool trailing_empty = true;
+
+    /**
+     *  @brief  The pattern to find.
+     */
+    std::vector<element_type> pattern = {};
+
+    /**
+     *  @brief  Skip table of Boyer-Moore-Horspool indexed by byte, or failure
+     *          table of Knuth-Morris-Pratt indexed by pattern position.
+     */
+    std::vector<std::size_t> table = {};
+
+    /**
+     *  @brief  Creates a searcher with empty pattern.
+     */
+    inline constexpr searcher() = default;
+
+    /**
+     *  @brief  Compile the pattern.
+     *
+     *  @tparam  Pattern  A compatible container type of pattern.
+     *  @param   to_find  The pattern to find.
+     */
+    template<cu_compatible Pattern>
+    requires(std::is_same_v<value_type<Pattern>, element_type>)
+    inline constexpr searcher(const Pattern &to_find)
+        : pattern(to_find.begin(), to_find.end())
+    {
+        std::size_t size = pattern.size();
+        if (size < 2) return;
+
+        if constexpr (byte_like<element_type>)
+        {
+            table.assign(256, size);
+            for (std::size_t i = 0; i < size - 1; i++)
+            {
+                table[byte(pattern[i])] = size - 1 - i;
+            }
+        }
+        else
+        {
+            table.assign(size, 0);
+            for (std::size_t i = 1, k = 0; i < size; i++)
+            {
+                while (k > 0 && !(pattern[i] == pattern[k]))
+                {
+                    k = table[k - 1];
+                }
+                if (pattern[i] == pattern[k]) k++;
+                table[i] = k;
+            }
+        }
+    }
+
+    /**
+     *  @brief  Get the byte value of an element.
+     *
+     *  @param  element  A byte-like element.
+     *  @return  Byte value of the element.
+     */
+    [[nodiscard]] static inline constexpr auto byte(
+        const element_type &element
+    ) -> std::size_t
+    {
+        return std::bit_cast<unsigned char>(element);
+    }
+
+    /**
+     *  @brief  Find the first occurrence of an element.
+     *
+     *  @param  first    The first element to search from.
+     *  @param  last     The end of elements.
+     *  @param  element  The element to find.
+     *  @return  Pointer to the element, or @c last if not found.
+     */
+    [[nodiscard]] static inline constexpr auto find_element(
+        const element_type *first,
+        const element_type *last,
+        const element_type &element
+    ) -> const element_type *
+    {
+        if constexpr (byte_like<element_type>)
+        {
+            if !consteval
+            {
+                auto found = std::memchr(first, (int)byte(element),
+                    (std::size_t)(last - first));
+                return found ? (const element_type *)found : last;
+            }
+        }
+        return std::find(first, last, element);
+    }
+
+    /**
+     *  @brief  Find the first occurrence of the pattern.
+     *
+     *  @param  first  The first element to search from.
+     *  @param  last   The end of elements.
+     *  @return  Matched elements, or empty span at @c last if not found.
+     */
+    [[nodiscard]] inline constexpr auto find(
+        const element_type *first,
+        const element_type *last
+    ) const -> std::span<const element_type>
+    {
+        std::size_t size  = pattern.size();
+        std::size_t count = (std::size_t)(last - first);
+
+        if (size == 0) return std::span<const element_type>(first, 0);
+        if (count < size) return std::span<const element_type>(last, 0);
+
+        if (size == 1)
+        {
+            auto found = find_element(first, last, pattern[0]);
+            return std::span<const element_type>(found, found == last ? 0 : 1);
+        }
+
+        if constexpr (byte_like<element_type>)
+        {
+            for (std::size_t i = 0; i <= count - size;
+                i += table[byte(first[i + size - 1])])
+            {
+                if (std::equal(pattern.begin(), pattern.end(), first + i))
+                {
+                    return std::span<const element_type>(first + i, size);
+                }
+            }
+        }
+        else
+        {
+            std::size_t k = 0;
+            for (auto it = first; it != last; it++)
+            {
+                while (k > 0 && !(*it == pattern[k]))
+                {
+                    k = table[k - 1];
+                }
+                if (*it == pattern[k]) k++;
+                if (k == size)
+                {
+                    return std::span<const element_type>(it + 1 - size, size);
+                }
+            }
+        }
+
+        return std::span<const element_type>(last, 0);
+    }
+};
+
+/**
+ *  @brief  Lazy versions of Container Utilities.
+ *
+ *  Views does not copy any element, they yield @c std::span of the elements of
+ *  the container instead.  The container (and the patterns) must outlive the
+ *  view.
+ */
+namespace views {
+
+/**
+ *  @brief  Matcher to split with a sequence.
+ *  @tparam  T  The type of element.
+ */
+template<typename T>
+struct seq_matcher {
+
+    /**
+     *  @brief  The sequence to find.
+     */
+    std::span<const T> pattern;
+
+    /**
+     *  @brief  Container ending with the pattern ends with an empty piece.
+     */
+    static constexpr bool trailing_empty = true;
+
+    /**
+     *  @brief  Find the first occurrence of the pattern.
+     *
+     *  @param  first  The first element to search from.
+     *  @param  last   The end of elements.
+     *  @return  Matched elements, or empty span at @c last if not found.
+     */
+    [[nodiscard]] inline constexpr auto find(
+        const T *first,
+        const T *last
+    ) const -> std::span<const T>
+    {
+        auto match = std::ranges::search(first, last, pattern.begin(),
+            pattern.end());
+        return std::span<const T>(match.begin(), match.end());
+    }
+};
+
+/**
+ *  @brief  Matcher to split with a value.
+ *  @tparam  T  The type of element.
+ */
+template<typename T>
+struct value_matcher {
+
+    /**
+     *  @brief  The value to find.
+     */
+    T value;
+
+    /**
+     *  @brief  Container ending with the value ends with an empty piece.
+     */
+    static constexpr bool trailing_empty = true;
+
+    /**
+     *  @brief  Find the first occurrence of the value.
+     *
+     *  @param  first  The first element to search from.
+     *  @param  last   The end of elements.
+     *  @return  Matched element, or empty span at @c last if not found.
+     */
+    [[nodiscard]] inline constexpr auto find(
+        const T *first,
+        const T *last
+    ) const -> std::span<const T>
+    {
+        auto match = std::find(first, last, value);
+        return std::span<const T>(match, match == last ? 0 : 1);
+    }
+};
+
+/**
+ *  @brief  Matcher to split with occurrences of any of values.
+ *  @tparam  T  The type of element.
+ */
+template<typename T>
+struct occ_matcher {
+
+    /**
+     *  @brief  The values to find.
+     */
+    std::span<const T> values;
+
+    /**
+     *  @brief  Container ending with one of values does not end with an
+     *          empty piece.
+     */
+    static constexpr bool trailing_empty = false;
+
+    /**
+     *  @brief  Find the first occurrence of any of values.
+     *
+     *  @param  first  The first element to search from.
+     *  @param  last   The end of elements.
+     *  @return  Matched element, or empty span at @c last if not found.
+     */
+    [[nodiscard]] inline constexpr auto find(
+        const T *first,
+        const T *last
+    ) const -> std::span<const T>
+    {
+        auto match = std::find_first_of(first, last, values.begin(),
+            values.end());
+        return std::span<const T>(match, match == last ? 0 : 1);
+    }
+};
+
+/**
+ *  @brief  Matcher for any of values, with byte-like values in a
+ *          @c byte_set .
+ *  @tparam  T  A byte-like type.
+ */
+template<byte_like T>
+struct occ_matcher<T> {
+
+    /**
+     *  @brief  The values to find.
+     */
+    byte_set set;
+
+    /**
+     *  @brief  Container ending with one of values does not end with an
+     *          empty piece.
+     */
+    static constexpr bool trailing_empty = false;
+
+    /**
+     *  @brief  Construct the matcher.
+     *  @param  values  The values to find.
+     */
+    inline constexpr explicit occ_matcher(std::span<const T> values)
+        : set(values)
+    {}
+
+    /**
+     *  @brief  Construct the matcher from a prebuilt set.
+     *  @param  values  The values to find.
+     */
+    inline constexpr explicit occ_matcher(const byte_set &values)
+        : set(values)
+    {}
+
+    /**
+     *  @brief  Find the first occurrence of any of values.
+     *
+     *  @param  first  The first element to search from.
+     *  @param  last   The end of elements.
+     *  @return  Matched element, or empty span at @c last if not found.
+     */
+    [[nodiscard]] inline constexpr auto find(
+        const T *first,
+        const T *last
+    ) const -> std::span<const T>
+    {
+        auto match = set.find(first, last);
+        return std::span<const T>(match, match == last ? 0 : 1);
+    }
+};
+
+/**
+ *  @brief  Matcher referring to another matcher, such as a prebuilt
+ *          @c multi_searcher .
+ *  @tparam  Matcher  The matcher type.
+ */
+template<typename Matcher>
+struct matcher_ref {
+
+    /**
+     *  @brief  The matcher referred to.
+     */
+    const Matcher *matcher = nullptr;
+
+    /**
+     *  @brief  Same as the matcher referred to.
+     */
+    static constexpr bool trailing_empty = Matcher::trailing_empty;
+
+    /**
+     *  @brief  Find with the matcher referred to.
+     *
+     *  @tparam  T      The type of element.
+     *  @param   first  The first element to search from.
+     *  @param   last   The end of elements.
+     *  @return  Matched elements, or empty span at @c last if not found.
+     */
+    template<typename T>
+    [[nodiscard]] inline constexpr auto find(
+        const T *first,
+        const T *last
+    ) const -> std::span<const T>
+    {
+        return matcher->find(first, last);
+    }
+};
+
+/**
+ *  @brief  A view of pieces of elements split by a matcher.
+ *
+ *  The pieces are @c std::span of the elements between the matches, the
+ *  elements of matches are not part of any piece.  An empty match splits the
+ *  element it matched at into its own piece, just like @c std::views::split .
+ *
+ *  @tparam  T        The type of element.
+ *  @tparam  Matcher  The matcher type, such as @c seq_matcher .
+ */
+template<typename T, typename Matcher>
+struct split_view : std::ranges::view_interface<split_view<T, Matcher>> {
+
+    /**
+     *  @brief  Elements to split.
+     */
+    std::span<const T> elements;
+
+    /**
+     *  @brief  The matcher to find the splitting elements with.
+     */
+    Matcher matcher;
+
+    /**
+     *  @brief  Iterator to iterate over each piece.
+     */
+    struct iterator {
+
+        /**
+         *  @brief  Iterator concept.
+         */
+        using iterator_concept = std::forward_iterator_tag;
+
+        /**
+         *  @brief  Iterator value type.
+         */
+        using value_type = std::span<const T>;
+
+        /**
+         *  @brief  Iterator difference type.
+         */
+        using difference_type = std::ptrdiff_t;
+
+        /**
+         *  @brief  The view this iterator belongs to.
+         */
+        const split_view *view = nullptr;
+
+        /**
+         *  @brief  The first element of the current piece.
+         */
+        const T *current = nullptr;
+
+        /**
+         *  @brief  The match after the current piece.
+         */
+        std::span<const T> next = {};
+
+        /**
+         *  @brief  The empty piece after the last match is yet to come.
+         */
+        bool trailing_empty = false;
+
+        /**
+         *  @brief  Find the match after an element.
+         *
+         *  @param  first  The element to find from.
+         *  @return  The match after the element.
+         */
+        [[nodiscard]] inline constexpr auto find_next(const T *first) const
+        {
+            const T *last  = view->elements.data() + view->elements.size();
+            auto     match = view->matcher.find(first, last);
+
+            // Do not get stuck at an empty match
+            if (match.empty() && match.data() != last)
+            {
+                match = std::span<const T>(match.data() + 1, 0);
+            }
+            return match;
+        }
+
+        /**
+         *  @brief  Get the current piece.
+         *  @return  Current piece.
+         */
+        [[nodiscard]] inline constexpr auto operator* () const
+        {
+            return std::span<const T>(current, next.data());
+        }
+
+        /**
+         *  @brief  Advance to the next piece.
+         *  @return  Reference to self.
+         */
+        inline constexpr auto operator++ () -> iterator &
+        {
+            const T *last = view->elements.data() + view->elements.size();
+
+            current = next.data();
+            if (current == last)
+            {
+                trailing_empty = false;
+                return *this;
+            }
+
+            current = next.data() + next.size();
+            if (current == last)
+            {
+                trailing_empty = Matcher::trailing_empty;
+                next           = std::span<const T>(last, 0);
+                return *this;
+            }
+
+            next = find_next(current);
+            return *this;
+        }
+
+        /**
+         *  @brief  Advance to the next piece.
+         *  @return  Copy of self before advancing.
+         */
+        inline constexpr auto operator++ (int) -> iterator
+        {
+            auto copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        /**
+         *  @brief  Compare two iterators.
+         *
+         *  @param  a  The first iterator.
+         *  @param  b  The second iterator.
+         *  @return  True if both are at the same piece.
+         */
+        [[nodiscard]] friend inline constexpr auto operator== (
+            const iterator &a,
+            const iterator &b
+        ) -> bool
+        {
+            return a.current == b.current
+                && a.trailing_empty == b.trailing_empty;
+        }
+
+        /**
+         *  @brief  Check if the iterator is past the last piece.
+         *
+         *  @param  it  An iterator.
+         *  @return  True if there are no more pieces.
+         */
+        [[nodiscard]] friend inline constexpr auto operator== (
+            const iterator &it,
+            std::default_sentinel_t
+        ) -> bool
+        {
+            return it.current == it.view->elements.data()
+                   + it.view->elements.size()
+                && !it.trailing_empty;
+        }
+    };
+
+    /**
+     *  @brief  Creates an empty view.
+     */
+    inline constexpr split_view() = default;
+
+    /**
+     *  @brief  Creates a view of pieces of elements.
+     *
+     *  @param  input     Elements to split.
+     *  @param  splitter  The matcher to find the splitting elements with.
+     */
+    inline constexpr split_view(
+        std::span<const T> input,
+        Matcher            splitter
+    ) : elements(input), matcher(std::move(splitter)) {}
+
+    /**
+     *  @brief  Get the iterator to the first piece.
+     *  @return  Iterator to the first piece.
+     */
+    [[nodiscard]] inline constexpr auto begin() const
+    {
+        iterator it = { this, elements.data() };
+        it.next = it.find_next(elements.data());
+        return it;
+    }
+
+    /**
+     *  @brief  Get the sentinel past the last piece.
+     *  @return  Sentinel past the last piece.
+     */
+    [[nodiscard]] inline constexpr auto end() const
+    {
+        return std::default_sentinel;
+    }
+};
+
+/**
+ *  @brief  Lazily split the container with pattern.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @param   container  A container.
+ *  @param   pattern    A pattern to split with.
+ *  @return  Split container as @c split_view .
+ *
+ *  @see  cu::split_seq.
+ */
+template<cu_compatible Container>
+[[nodiscard]] inline constexpr auto split_seq(
+    const Container &container,
+    const Container &pattern
+)
+{
+    using T = value_type<Container>;
+    return split_view<T, seq_matcher<T>>(as_span(container),
+        seq_matcher<T> { as_span(pattern) });
+}
+
+/**
+ *  @brief  Lazily split the container with pattern.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @tparam  Pattern    A compatible container type of pattern.
+ *  @param   container  A container.
+ *  @param   searcher   Compiled pattern to split with.
+ *  @return  Split container as @c split_view .
+ *
+ *  @see  cu::split_seq.
+ */
+template<cu_compatible Container, cu_compatible Pattern>
+requires(std::is_same_v<value_type<Container>, value_type<Pattern>>)
+[[nodiscard]] inline constexpr auto split_seq(
+    const Container         &container,
+    const searcher<Pattern> &searcher
+)
+{
+    using T       = value_type<Container>;
+    using Matcher = matcher_ref<cu::searcher<Pattern>>;
+    return split_view<T, Matcher>(as_span(container), Matcher { &searcher });
+}
+
+/**
+ *  @brief  Lazily split the container with occurrences of value.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @param   container  A container.
+ *  @param   values     The values to split with.
+ *  @return  Split container as @c split_view .
+ *
+ *  @see  cu::split_occ.
+ */
+template<cu_compatible Container>
+[[nodiscard]] inline constexpr auto split_occ(
+    const Container &container,
+    const Container &values
+)
+{
+    using T = value_type<Container>;
+    return split_view<T, occ_matcher<T>>(as_span(container),
+        occ_matcher<T>(as_span(values)));
+}
+
+/**
+ *  @brief  Lazily split the container with occurrences of any of values in
+ *          a prebuilt set.
+ *
+ *  @tparam  Container  A compatible container type of byte-like values.
+ *  @param   container  A container.
+ *  @param   values     The set of values to split with.
+ *  @return  Split container as @c split_view .
+ *
+ *  @see  cu::split_occ.
+ */
+template<cu_compatible Container>
+requires(byte_like<value_type<Container>>)
+[[nodiscard]] inline constexpr auto split_occ(
+    const Container &container,
+    const byte_set  &values
+)
+{
+    using T = value_type<Container>;
+    return split_view<T, occ_matcher<T>>(as_span(container),
+        occ_matcher<T>(values));
+}
+
+/**
+ *  @brief  Lazily split the container with occurrences of any of pattern.
+ *
+ *  @tparam  Container        A compatible container type.
+ *  @tparam  NestedContainer  A compatible container type nested container type.
+ *  @param   container        A container.
+ *  @param   patterns         The patterns to split with.
+ *  @return  Split container as @c split_view .
+ *
+ *  @see  cu::split_occ_seq.
+ */
+template<cu_compatible Container, cu_compatible_nested NestedContainer>
+[[nodiscard]] inline constexpr auto split_occ_seq(
+    const Container       &container,
+    const NestedContainer &patterns
+)
+{
+    using T       = value_type<Container>;
+    using Matcher = multi_searcher<value_type<NestedContainer>>;
+    return split_view<T, Matcher>(as_span(container), Matcher(patterns));
+}
+
+/**
+ *  @brief  Lazily split the container with occurrences of any of pattern.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @tparam  Pattern    A compatible container type of pattern.
+ *  @param   container  A container.
+ *  @param   searcher   Compiled patterns to split with.
+ *  @return  Split container as @c split_view .
+ *
+ *  @see  cu::split_occ_seq.
+ */
+template<cu_compatible Container, cu_compatible Pattern>
+requires(std::is_same_v<value_type<Container>, value_type<Pattern>>)
+[[nodiscard]] inline constexpr auto split_occ_seq(
+    const Container               &container,
+    const multi_searcher<Pattern> &searcher
+)
+{
+    using T       = value_type<Container>;
+    using Matcher = matcher_ref<multi_searcher<Pattern>>;
+    return split_view<T, Matcher>(as_span(container), Matcher { &searcher });
+}
+
+/**
+ *  @brief  Lazily split the container with value.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @param   container  A container.
+ *  @param   value      A value to split with.
+ *  @return  Split container as @c split_view .
+ *
+ *  @see  cu::split.
+ */
+template<cu_compatible Container>
+[[nodiscard]] inline constexpr auto split(
+    const Container             &container,
+    const value_type<Container> &value
+)
+{
+    using T = value_type<Container>;
+    return split_view<T, value_matcher<T>>(as_span(container),
+        value_matcher<T> { value });
+}
+
+} // namespace views
+
+/**
+ *  @brief  Incremental splitter fed with successive chunks of a stream.
+ *
+ *  The pieces are passed to a function as soon as the match after them is
+ *  known, and both pieces and matches may straddle the chunk boundaries.  Only
+ *  the unfinished piece (with the partially matched pattern) is kept between
+ *  the feeds, so the memory use is bounded by the longest piece rather than
+ *  the size of the stream.  The pieces are the same as the pieces of
+ *  @c views::split_view of the whole stream.
+ *
+ *  @tparam  T        The type of element.
+ *  @tparam  Matcher  The matcher type, such as @c views::seq_matcher .
+ */
+template<typename T, typename Matcher>
+struct stream_splitter {
+
+    /**
+     *  @brief  The matcher to find the splitting elements with.
+     */
+    Matcher matcher;
+
+    /**
+     *  @brief  Size of the longest match of the matcher.
+     */
+    std::size_t longest = 0;
+
+    /**
+     *  @brief  Elements of the unfinished piece.
+     */
+    std::vector<T> buffer = {};
+
+    /**
+     *  @brief  Index of the buffer before which no match can start.
+     */
+    std::size_t searched = 0;
+
+    /**
+     *  @brief  The last complete piece ended with a match.
+     */
+    bool matched = false;
+
+    /**
+     *  @brief  Creates a splitter.
+     *
+     *  @param  splitter      The matcher to find the splitting elements with.
+     *  @param  longest_size  Size of the longest match of the matcher.
+     */
+    inline constexpr stream_splitter(
+        Matcher     splitter,
+        std::size_t longest_size
+    ) : matcher(std::move(splitter)), longest(longest_size) {}
+
+    /**
+     *  @brief  Pass the complete pieces of elements to the function.
+     *
+     *  A match that a longer or an earlier match could replace once more
+     *  elements arrive is only accepted when no more elements follow.
+     *
+     *  @tparam  Function  A function type taking @c std::span<const T> .
+     *  @param   elements  The elements to split, starting at a piece.
+     *  @param   final     No more elements follow.
+     *  @param   function  The function to pass the pieces to.
+     *  @return  Index of the first element of the unfinished piece.
+     */
+    template<typename Function>
+    inline constexpr auto scan(
+        std::span<const T> elements,
+        bool               final,
+        Function          &function
+    ) -> std::size_t
+    {
+        const T *first   = elements.data();
+        const T *last    = first + elements.size();
+        const T *current = first;
+
+        // Partial matches cannot start before the tail
+        std::size_t window = std::max<std::size_t>(longest, 1) - 1;
+        std::size_t tail   = elements.size()
+                           - std::min(elements.size(), window);
+
+        while (current != last)
+        {
+            auto match = matcher.find(first + searched, last);
+            bool found = match.data() != last;
+
+            if (!final && (!found || (match.size() != longest
+                && match.data() + longest > last)))
+            {
+                searched = std::max<std::size_t>(current - first,
+                    std::min<std::size_t>(match.data() - first, tail));
+                break;
+            }
+            if (!found) break;
+
+            // Do not get stuck at an empty match
+            if (match.empty())
+            {
+                match = std::span<const T>(match.data() + 1, 0);
+            }
+
+            function(std::span<const T>(current, match.data()));
+            current  = match.data() + match.size();
+            searched = current - first;
+            matched  = !match.empty();
+        }
+
+        searched -= current - first;
+        return current - first;
+    }
+
+    /**
+     *  @brief  Feed the next chunk of the stream.
+     *
+     *  @tparam  Container  A compatible container type.
+     *  @tparam  Function   A function type taking @c std::span<const T> .
+     *  @param   chunk      The next chunk.
+     *  @param   function   The function to pass the complete pieces to.
+     */
+    template<cu_compatible Container, typename Function>
+    requires(std::is_same_v<value_type<Container>, T>)
+    inline constexpr auto feed(
+        const Container &chunk,
+        Function       &&function
+    ) -> void
+    {
+        auto elements = as_span(chunk);
+
+        // Split the chunk in place if there is no unfinished piece
+        if (buffer.empty())
+        {
+            std::size_t consumed = scan(elements, false, function);
+            buffer.assign(elements.begin() + consumed, elements.end());
+            return;
+        }
+
+        buffer.insert(buffer.end(), elements.begin(), elements.end());
+        std::size_t consumed = scan(as_span(buffer), false, function);
+        buffer.erase(buffer.begin(), buffer.begin() + consumed);
+    }
+
+    /**
+     *  @brief  End the stream, pass the remaining pieces to the function and
+     *          reset the splitter for another stream.
+     *
+     *  @tparam  Function  A function type taking @c std::span<const T> .
+     *  @param   function  The function to pass the remaining pieces to.
+     */
+    template<typename Function>
+    inline constexpr auto finish(Function &&function) -> void
+    {
+        auto        elements = as_span(buffer);
+        std::size_t consumed = scan(elements, true, function);
+
+        if (consumed != elements.size())
+        {
+            function(elements.subspan(consumed));
+        }
+        else if (matched && Matcher::trailing_empty)
+        {
+            function(elements.subspan(consumed));
+        }
+
+        buffer.clear();
+        searched = 0;
+        matched  = false;
+    }
+};
+
+/**
+ *  @brief  Create a stream splitter splitting with pattern.
+ *
+ *  The pattern is compiled into the splitter, so it does not need to outlive
+ *  the splitter.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @param   pattern    A pattern to split with.
+ *  @return  Splitter as @c stream_splitter .
+ *
+ *  @see  cu::split_seq.
+ */
+template<cu_compatible Container>
+[[nodiscard]] inline constexpr auto stream_split_seq(const Container &pattern)
+{
+    using T       = value_type<Container>;
+    using Matcher = searcher<std::vector<T>>;
+    return stream_splitter<T, Matcher>(Matcher(pattern), pattern.size());
+}
+
+/**
+ *  @brief  Create a stream splitter splitting with pattern.
+ *
+ *  @tparam  Pattern   A compatible container type of pattern.
+ *  @param   searcher  Compiled pattern to split with, must outlive the
+ *                     splitter.
+ *  @return  Splitter as @c stream_splitter .
+ *
+ *  @see  cu::split_seq.
+ */
+template<cu_compatible Pattern>
+[[nodiscard]] inline constexpr auto stream_split_seq(
+    const searcher<Pattern> &searcher
+)
+{
+    using T       = value_type<Pattern>;
+    using Matcher = views::matcher_ref<cu::searcher<Pattern>>;
+    return stream_splitter<T, Matcher>(Matcher { &searcher },
+        searcher.pattern.size());
+}
+
+/**
+ *  @brief  Create a stream splitter splitting with occurrences of value.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @param   values     The values to split with, must outlive the splitter.
+ *  @return  Splitter as @c stream_splitter .
+ *
+ *  @see  cu::split_occ.
+ */
+template<cu_compatible Container>
+[[nodiscard]] inline constexpr auto stream_split_occ(const Container &values)
+{
+    using T = value_type<Container>;
+    return stream_splitter<T, views::occ_matcher<T>>(
+        views::occ_matcher<T>(as_span(values)), 1);
+}
+
+/**
+ *  @brief  Create a stream splitter splitting with occurrences of any of
+ *          pattern.
+ *
+ *  @tparam  NestedContainer  A compatible container type nested container type.
+ *  @param   patterns         The patterns to split with.
+ *  @return  Splitter as @c stream_splitter .
+ *
+ *  @see  cu::split_occ_seq.
+ */
+template<cu_compatible_nested NestedContainer>
+[[nodiscard]] inline constexpr auto stream_split_occ_seq(
+    const NestedContainer &patterns
+)
+{
+    using T       = value_type<value_type<NestedContainer>>;
+    using Matcher = multi_searcher<value_type<NestedContainer>>;
+
+    Matcher     matcher(patterns);
+    std::size_t longest = matcher.longest;
+    return stream_splitter<T, Matcher>(std::move(matcher), longest);
+}
+
+/**
+ *  @brief  Create a stream splitter splitting with occurrences of any of
+ *          pattern.
+ *
+ *  @tparam  Pattern   A compatible container type of pattern.
+ *  @param   searcher  Compiled patterns to split with, must outlive the
+ *                     splitter.
+ *  @return  Splitter as @c stream_splitter .
+ *
+ *  @see  cu::split_occ_seq.
+ */
+template<cu_compatible Pattern>
+[[nodiscard]] inline constexpr auto stream_split_occ_seq(
+    const multi_searcher<Pattern> &searcher
+)
+{
+    using T       = value_type<Pattern>;
+    using Matcher = views::matcher_ref<multi_searcher<Pattern>>;
+    return stream_splitter<T, Matcher>(Matcher { &searcher },
+        searcher.longest);
+}
+
+/**
+ *  @brief  Create a stream splitter splitting with value.
+ *
+ *  @tparam  T      The type of element.
+ *  @param   value  A value to split with.
+ *  @return  Splitter as @c stream_splitter .
+ *
+ *  @see  cu::split.
+ */
+template<typename T>
+[[nodiscard]] inline constexpr auto stream_split(const T &value)
+{
+    return stream_splitter<T, views::value_matcher<T>>(
+        views::value_matcher<T> { value }, 1);
+}
+
+/**
+ *  @brief  Container Utilities' implementation details.
+ */
+namespace impl {
+
+/**
+ *  @brief  Count the pieces without copying them.
+ *
+ *  @tparam  Pieces  A range type of pieces.
+ *  @param   pieces  The pieces to count.
+ *  @return  The number of pieces.
+ */
+template<typename Pieces>
+[[nodiscard]] inline constexpr auto count_pieces(Pieces &&pieces)
+-> std::size_t
+{
+    std::size_t count = 0;
+    for (auto it = pieces.begin(); it != pieces.end(); ++it) count++;
+    return count;
+}
+
+/**
+ *  @brief  Sum the sizes of the pieces without copying them.
+ *
+ *  @tparam  Pieces  A range type of pieces.
+ *  @param   pieces  The pieces to measure.
+ *  @return  The total number of elements of the pieces.
+ */
+template<typename Pieces>
+[[nodiscard]] inline constexpr auto pieces_size(Pieces &&pieces)
+-> std::size_t
+{
+    std::size_t size = 0;
+    for (auto piece : pieces) size += piece.size();
+    return size;
+}
+
+/**
+ *  @brief  Create a container to write @c size elements into, reserving the
+ *          storage if the container can.
+ *
+ *  @tparam  Result  The container type.
+ *  @param   size    The number of elements to reserve for.
+ *  @return  Empty container as @c Result .
+ */
+template<typename Result>
+[[nodiscard]] inline constexpr auto reserved(std::size_t size) -> Result
+{
+    Result result;
+    if constexpr (requires { result.reserve(size); })
+    {
+        result.reserve(size);
+    }
+    return result;
+}
+
+/**
+ *  @brief  Copy pieces into nested container, with the inner containers
+ *          using the same allocator as the outer.
+ *
+ *  @tparam  Result     The nested container type.
+ *  @tparam  Pieces     A range type of pieces.
+ *  @tparam  Allocator  An allocator type, or @c std::pmr::memory_resource
+ *                      pointer type.
+ *  @param   pieces     The pieces to copy.
+ *  @param   allocator  The allocator of the result.
+ *  @return  Copied pieces as @c Result .
+ */
+template<typename Result, typename Pieces, typename Allocator>
+[[nodiscard]] inline constexpr auto to_nested(
+    Pieces         &&pieces,
+    const Allocator &allocator
+) -> Result
+{
+    using Inner = Result::value_type;
+
+    Result result(make_allocator<Inner>(allocator));
+    if constexpr (std::ranges::forward_range<Pieces>)
+    {
+        result.reserve(count_pieces(pieces));
+    }
+    for (auto piece : pieces)
+    {
+        result.push_back(Inner(piece.begin(), piece.end(),
+            make_allocator<typename Inner::value_type>(allocator)));
+    }
+    return result;
+}
+
+/**
+ *  @brief  Split the number of times to repeat into whole repeats and the
+ *          fractional part.
+ *
+ *  Negative and NaN numbers repeat zero times, and numbers too large for
+ *  @c std::size_t are clamped to its maximum with no fractional part.
+ *
+ *  @tparam  Number  An arithmetic type.
+ *  @param   n       The number of times to repeat.
+ *  @return  Pair of whole repeats and the fractional part.
+ */
+template<typename Number>
+requires(std::is_arithmetic_v<Number>)
+[[nodiscard]] inline constexpr auto repeat_parts(Number n)
+-> std::pair<std::size_t, long double>
+{
+    constexpr auto limit = std::numeric_limits<std::size_t>::max();
+
+    // Performance-critical, don't use exceptions
+    if constexpr (std::is_floating_point_v<Number>)
+    {
+        // Also false for NaN
+        if (!(n > (Number)0)) return { 0, 0 };
+        if (n >= (Number)limit) return { limit, 0 };
+
+        // Truncating casts instead of std::modf, to work at compile time
+        std::size_t regular_repeat = (std::size_t)n;
+        return { regular_repeat, (long double)n - regular_repeat };
+    }
+    else
+    {
+        if constexpr (std::is_signed_v<Number>)
+        {
+            if (n < (Number)0) return { 0, 0 };
+        }
+        return { (std::size_t)n, 0 };
+    }
+}
+
+/**
+ *  @brief  Compute the number of whole repeats and the size of the partial
+ *          repeat for repeating a container of @c size elements @c n times.
+ *
+ *  @tparam  Number  An arithmetic type.
+ *  @param   size    The size of the container to repeat.
+ *  @param   n       The number of times to repeat.
+ *  @return  Pair of whole repeats and size of the partial repeat.
+ */
+template<typename Number>
+requires(std::is_arithmetic_v<Number>)
+[[nodiscard]] inline constexpr auto repeat_counts(std::size_t size, Number n)
+-> std::pair<std::size_t, std::size_t>
+{
+    auto [regular_repeat, f_part] = repeat_parts(n);
+    return { regular_repeat, (std::size_t)(f_part * size) };
+}
+
+/**
+ *  @brief  Get the mutable iterator to the start of a piece viewing the
+ *          container.
+ *
+ *  Pieces are read-only views, moving through them would copy.
+ *
+ *  @tparam  Container  A compatible contiguous container type.
+ *  @tparam  Piece      A contiguous range type viewing @c container .
+ *  @param   container  The container the piece views.
+ *  @param   piece      The piece.
+ *  @return  Iterator to the first element of the piece in @c container .
+ */
+template<typename Container, typename Piece>
+[[nodiscard]] inline constexpr auto piece_begin(
+    Container   &container,
+    const Piece &piece
+)
+{
+    return container.begin()
+         + (piece.data() - std::to_address(container.begin()));
+}
+
+/**
+ *  @brief  Move the pieces to the front of the container they view and erase
+ *          the rest.
+ *
+ *  Pieces must be in order and not overlap, so writes never overtake reads.
+ *
+ *  @tparam  Container  A compatible resizable container type.
+ *  @tparam  Pieces     A range type of pieces into @c container .
+ *  @param   container  The container the pieces view.
+ *  @param   pieces     The pieces to keep.
+ *  @return  The number of erased elements.
+ */
+template<typename Container, typename Pieces>
+inline constexpr auto compact(Container &container, Pieces &&pieces)
+-> std::size_t
+{
+    auto output = container.begin();
+    for (auto piece : pieces)
+    {
+        if (std::to_address(output) == piece.data())
+        {
+            output += piece.size();
+            continue;
+        }
+
+        auto first = piece_begin(container, piece);
+        output = std::move(first, first + piece.size(), output);
+    }
+
+    std::size_t erased = container.end() - output;
+    container.erase(output, container.end());
+    return erased;
+}
+
+/**
+ *  @brief  Move the pieces to the front of the container they view and take
+ *          over the container's buffer as @c jagged .
+ *
+ *  @tparam  T          The element type.
+ *  @tparam  Allocator  The allocator type.
+ *  @tparam  Pieces     A range type of pieces into @c container .
+ *  @param   container  The container the pieces view.
+ *  @param   pieces     The pieces to keep.
+ *  @return  The pieces as @c jagged , using the container's buffer.
+ */
+template<typename T, typename Allocator, typename Pieces>
+[[nodiscard]] inline constexpr auto compact_jagged(
+    std::vector<T, Allocator> &container,
+    Pieces                   &&pieces
+) -> jagged<T, Allocator>
+{
+    jagged<T, Allocator> result(container.get_allocator());
+
+    auto output = container.begin();
+    for (auto piece : pieces)
+    {
+        if (std::to_address(output) == piece.data())
+        {
+            output += piece.size();
+        }
+        else
+        {
+            auto first = piece_begin(container, piece);
+            output = std::move(first, first + piece.size(), output);
+        }
+        result.offsets.push_back(output - container.begin());
+    }
+
+    container.erase(output, container.end());
+    result.values = std::move(container);
+    return result;
+}
+
+} // namespace impl
+
+/**
+ *  @brief  Count the pieces of splitting the container with pattern, without
+ *          allocating.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @param   container  A container.
+ *  @param   pattern    A pattern to split with.
+ *  @return  The number of pieces @c cu::split_seq would produce.
+ */
+template<cu_compatible Container>
+[[nodiscard]] inline constexpr auto count_split_seq(
+    const Container &container,
+    const Container &pattern
+) -> std::size_t
+{
+    return impl::count_pieces(views::split_seq(container, pattern));
+}
+
+/**
+ *  @brief  Count the pieces of splitting the container with pattern, without
+ *          allocating.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @tparam  Pattern    A compatible container type of pattern.
+ *  @param   container  A container.
+ *  @param   searcher   Compiled pattern to split with.
+ *  @return  The number of pieces @c cu::split_seq would produce.
+ */
+template<cu_compatible Container, cu_compatible Pattern>
+requires(std::is_same_v<value_type<Container>, value_type<Pattern>>)
+[[nodiscard]] inline constexpr auto count_split_seq(
+    const Container         &container,
+    const searcher<Pattern> &searcher
+) -> std::size_t
+{
+    return impl::count_pieces(views::split_seq(container, searcher));
+}
+
+/**
+ *  @brief  Count the pieces of splitting the container with occurrences of
+ *          value, without allocating.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @param   container  A container.
+ *  @param   values     The values to split with.
+ *  @return  The number of pieces @c cu::split_occ would produce.
+ */
+template<cu_compatible Container>
+[[nodiscard]] inline constexpr auto count_split_occ(
+    const Container &container,
+    const Container &values
+) -> std::size_t
+{
+    return impl::count_pieces(views::split_occ(container, values));
+}
+
+/**
+ *  @brief  Count the pieces of splitting the container with occurrences of
+ *          any of pattern, without allocating.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @tparam  Pattern    A compatible container type of pattern.
+ *  @param   container  A container.
+ *  @param   searcher   Compiled patterns to split with.
+ *  @return  The number of pieces @c cu::split_occ_seq would produce.
+ */
+template<cu_compatible Container, cu_compatible Pattern>
+requires(std::is_same_v<value_type<Container>, value_type<Pattern>>)
+[[nodiscard]] inline constexpr auto count_split_occ_seq(
+    const Container               &container,
+    const multi_searcher<Pattern> &searcher
+) -> std::size_t
+{
+    return impl::count_pieces(views::split_occ_seq(container, searcher));
+}
+
+/**
+ *  @brief  Count the pieces of splitting the container with occurrences of
+ *          any of pattern.
+ *
+ *  Only the searcher of patterns is allocated, use the @c multi_searcher
+ *  overload to reuse it.
+ *
+ *  @tparam  Container        A compatible container type.
+ *  @tparam  NestedContainer  A compatible container type nested container type.
+ *  @param   container        A container.
+ *  @param   patterns         The patterns to split with.
+ *  @return  The number of pieces @c cu::split_occ_seq would produce.
+ */
+template<cu_compatible Container, cu_compatible_nested NestedContainer>
+[[nodiscard]] inline constexpr auto count_split_occ_seq(
+    const Container       &container,
+    const NestedContainer &patterns
+) -> std::size_t
+{
+    return impl::count_pieces(views::split_occ_seq(container, patterns));
+}
+
+/**
+ *  @brief  Count the pieces of splitting the container with value, without
+ *          allocating.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @param   container  A container.
+ *  @param   value      A value to split with.
+ *  @return  The number of pieces @c cu::split would produce.
+ */
+template<cu_compatible Container>
+[[nodiscard]] inline constexpr auto count_split(
+    const Container             &container,
+    const value_type<Container> &value
+) -> std::size_t
+{
+    return impl::count_pieces(views::split(container, value));
+}
+
+/**
+ *  @brief  Get the size of the container without the occurrences of sequence,
+ *          without allocating.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @param   container  A container.
+ *  @param   pattern    A sequence to remove.
+ *  @return  The size of the result of @c cu::filter_out_seq .
+ */
+template<cu_compatible Container>
+[[nodiscard]] inline constexpr auto filtered_size_seq(
+    const Container &container,
+    const Container &pattern
+) -> std::size_t
+{
+    return impl::pieces_size(views::split_seq(container, pattern));
+}
+
+/**
+ *  @brief  Get the size of the container without the occurrences of sequence,
+ *          without allocating.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @tparam  Pattern    A compatible container type of pattern.
+ *  @param   container  A container.
+ *  @param   searcher   Compiled sequence to remove.
+ *  @return  The size of the result of @c cu::filter_out_seq .
+ */
+template<cu_compatible Container, cu_compatible Pattern>
+requires(std::is_same_v<value_type<Container>, value_type<Pattern>>)
+[[nodiscard]] inline constexpr auto filtered_size_seq(
+    const Container         &container,
+    const searcher<Pattern> &searcher
+) -> std::size_t
+{
+    return impl::pieces_size(views::split_seq(container, searcher));
+}
+
+/**
+ *  @brief  Get the size of the container without the occurrences of any of
+ *          values, without allocating.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @param   container  A container.
+ *  @param   values     The elements to remove.
+ *  @return  The size of the result of @c cu::filter_out_occ .
+ */
+template<cu_compatible Container>
+[[nodiscard]] inline constexpr auto filtered_size_occ(
+    const Container &container,
+    const Container &values
+) -> std::size_t
+{
+    using T = value_type<Container>;
+
+    if constexpr (byte_like<T>)
+    {
+        return impl::pieces_size(views::split_occ(container, values));
+    }
+    else
+    {
+        auto filterer = [&](const T &element)
+        {
+            return std::ranges::find(values, element) == values.end();
+        };
+
+        return std::ranges::count_if(container, filterer);
+    }
+}
+
+/**
+ *  @brief  Get the size of the container without the occurrences of any of
+ *          sequences, without allocating.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @tparam  Pattern    A compatible container type of pattern.
+ *  @param   container  A container.
+ *  @param   searcher   Compiled sequences to remove.
+ *  @return  The size of the result of @c cu::filter_out_occ_seq .
+ */
+template<cu_compatible Container, cu_compatible Pattern>
+requires(std::is_same_v<value_type<Container>, value_type<Pattern>>)
+[[nodiscard]] inline constexpr auto filtered_size_occ_seq(
+    const Container               &container,
+    const multi_searcher<Pattern> &searcher
+) -> std::size_t
+{
+    return impl::pieces_size(views::split_occ_seq(container, searcher));
+}
+
+/**
+ *  @brief  Get the size of the container without the occurrences of any of
+ *          sequences.
+ *
+ *  Only the searcher of patterns is allocated, use the @c multi_searcher
+ *  overload to reuse it.
+ *
+ *  @tparam  Container        A compatible container type.
+ *  @tparam  NestedContainer  A compatible container type nested container type.
+ *  @param   container        A container.
+ *  @param   patterns         The sequences to remove.
+ *  @return  The size of the result of @c cu::filter_out_occ_seq .
+ */
+template<cu_compatible Container, cu_compatible_nested NestedContainer>
+[[nodiscard]] inline constexpr auto filtered_size_occ_seq(
+    const Container       &container,
+    const NestedContainer &patterns
+) -> std::size_t
+{
+    return impl::pieces_size(views::split_occ_seq(container, patterns));
+}
+
+/**
+ *  @brief  Get the size of the container without the occurrences of value,
+ *          without allocating.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @param   container  A container.
+ *  @param   value      A value to remove.
+ *  @return  The size of the result of @c cu::filter_out .
+ */
+template<cu_compatible Container>
+[[nodiscard]] inline constexpr auto filtered_size(
+    const Container             &container,
+    const value_type<Container> &value
+) -> std::size_t
+{
+    return container.size() - std::ranges::count(container, value);
+}
+
+/**
+ *  @brief  Get the size of repeating a container of @c size elements @c n
+ *          times.
+ *
+ *  @tparam  Number  An arithmetic type.
+ *  @param   size    The size of the container to repeat.
+ *  @param   n       The number of times to repeat.
+ *  @return  The size of the result of @c cu::repeat .
+ */
+template<typename Number>
+requires(std::is_arithmetic_v<Number>)
+[[nodiscard]] inline constexpr auto repeat_size(std::size_t size, Number n)
+-> std::size_t
+{
+    auto [regular_repeat, sub_size] = impl::repeat_counts(size, n);
+    return size * regular_repeat + sub_size;
+}
+
+/**
+ *  @brief  Get the allocator of the container for results of operations on
+ *          it.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @param   container  A container.
+ *  @return  Container's allocator if it has one, default allocator otherwise.
+ */
+template<cu_compatible Container>
+[[nodiscard]] inline constexpr auto allocator_of(const Container &container)
+{
+    if constexpr (requires { container.get_allocator(); })
+    {
+        return container.get_allocator();
+    }
+    else
+    {
+        return std::allocator<value_type<Container>>();
+    }
+}
+
+/**
+ *  @brief  Copy the subset of the container's elements.
+ *
+ *  @tparam  Container        A compatible container type.
+ *  @tparam  Output           An output iterator type.
+ *  @param   container        A container.
+ *  @param   first_inclusive  The first index (inclusive).
+ *  @param   last_exclusive   The last index (exclusive).
+ *  @param   output           The output iterator to write to.
+ *  @return  Iterator past the last written element.
+ *
+ *  @see  cu::subordinate.
+ */
+template<cu_compatible Container,
+    std::output_iterator<const value_type<Container> &> Output>
+inline constexpr auto subordinate_into(
+    const Container &container,
+    std::size_t      first_inclusive,
+    std::size_t      last_exclusive,
+    Output           output
+) -> Output
+{
+    return std::copy(container.begin() + first_inclusive,
+        container.begin() + last_exclusive, output);
+}
+
+/**
+ *  @brief  Copy the subset of the container's elements.
+ *
+ *  @tparam  Container        A compatible container type.
+ *  @tparam  Allocator        The allocator type of the vector.
+ *  @param   container        A container.
+ *  @param   first_inclusive  The first index (inclusive).
+ *  @param   last_exclusive   The last index (exclusive).
+ *  @param   output           The vector to append to.
+ *  @return  Iterator past the last appended element.
+ *
+ *  @see  cu::subordinate.
+ */
+template<cu_compatible Container, typename Allocator>
+inline constexpr auto subordinate_into(
+    const Container                               &container,
+    std::size_t                                    first_inclusive,
+    std::size_t                                    last_exclusive,
+    std::vector<value_type<Container>, Allocator> &output
+)
+{
+    output.reserve(output.size() + last_exclusive - first_inclusive);
+    subordinate_into(container, first_inclusive, last_exclusive,
+        std::back_inserter(output));
+    return output.end();
+}
+
+/**
+ *  @brief  Copy containers one after another.
+ *
+ *  @tparam  Container    A compatible container type.
+ *  @tparam  Output       An output iterator type.
+ *  @param   container_a  The first container.
+ *  @param   container_b  The second container.
+ *  @param   output       The output iterator to write to.
+ *  @return  Iterator past the last written element.
+ *
+ *  @see  cu::combine.
+ */
+template<cu_compatible Container,
+    std::output_iterator<const value_type<Container> &> Output>
+inline constexpr auto combine_into(
+    const Container &container_a,
+    const Container &container_b,
+    Output           output
+) -> Output
+{
+    output = std::copy(container_a.begin(), container_a.end(), output);
+    return std::copy(container_b.begin(), container_b.end(), output);
+}
+
+/**
+ *  @brief  Copy containers one after another.
+ *
+ *  @tparam  Container    A compatible container type.
+ *  @tparam  Allocator    The allocator type of the vector.
+ *  @param   container_a  The first container.
+ *  @param   container_b  The second container.
+ *  @param   output       The vector to append to.
+ *  @return  Iterator past the last appended element.
+ *
+ *  @see  cu::combine.
+ */
+template<cu_compatible Container, typename Allocator>
+inline constexpr auto combine_into(
+    const Container                               &container_a,
+    const Container                               &container_b,
+    std::vector<value_type<Container>, Allocator> &output
+)
+{
+    output.reserve(output.size() + container_a.size() + container_b.size());
+    combine_into(container_a, container_b, std::back_inserter(output));
+    return output.end();
+}
+
+/**
+ *  @brief  Copy container and value one after another.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @tparam  Output     An output iterator type.
+ *  @param   container  A container.
+ *  @param   value      A value of container's value type.
+ *  @param   output     The output iterator to write to.
+ *  @return  Iterator past the last written element.
+ *
+ *  @see  cu::combine.
+ */
+template<cu_compatible Container,
+    std::output_iterator<const value_type<Container> &> Output>
+inline constexpr auto combine_into(
+    const Container             &container,
+    const value_type<Container> &value,
+    Output                       output
+) -> Output
+{
+    output    = std::copy(container.begin(), container.end(), output);
+    *output++ = value;
+    return output;
+}
+
+/**
+ *  @brief  Copy container and value one after another.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @tparam  Allocator  The allocator type of the vector.
+ *  @param   container  A container.
+ *  @param   value      A value of container's value type.
+ *  @param   output     The vector to append to.
+ *  @return  Iterator past the last appended element.
+ *
+ *  @see  cu::combine.
+ */
+template<cu_compatible Container, typename Allocator>
+inline constexpr auto combine_into(
+    const Container                               &container,
+    const value_type<Container>                   &value,
+    std::vector<value_type<Container>, Allocator> &output
+)
+{
+    output.reserve(output.size() + container.size() + 1);
+    combine_into(container, value, std::back_inserter(output));
+    return output.end();
+}
+
+/**
+ *  @brief  Copy the container without the occurrences of sequence.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @tparam  Output     An output iterator type.
+ *  @param   container  A container.
+ *  @param   pattern    A sequence to remove.
+ *  @param   output     The output iterator to write to.
+ *  @return  Iterator past the last written element.
+ *
+ *  @see  cu::filter_out_seq.
+ */
+template<cu_compatible Container,
+    std::output_iterator<const value_type<Container> &> Output>
+inline constexpr auto filter_out_seq_into(
+    const Container &container,
+    const Container &pattern,
+    Output           output
+) -> Output
+{
+    return filter_out_seq_into(container, searcher<Container>(pattern),
+        output);
+}
+
+/**
+ *  @brief  Copy the container without the occurrences of sequence.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @tparam  Allocator  The allocator type of the vector.
+ *  @param   container  A container.
+ *  @param   pattern    A sequence to remove.
+ *  @param   output     The vector to append to.
+ *  @return  Iterator past the last appended element.
+ *
+ *  @see  cu::filter_out_seq.
+ */
+template<cu_compatible Container, typename Allocator>
+inline constexpr auto filter_out_seq_into(
+    const Container                               &container,
+    const Container                               &pattern,
+    std::vector<value_type<Container>, Allocator> &output
+)
+{
+    filter_out_seq_into(container, pattern, std::back_inserter(output));
+    return output.end();
+}
+
+/**
+ *  @brief  Copy the container without the occurrences of sequence.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @tparam  Pattern    A compatible container type of pattern.
+ *  @tparam  Output     An output iterator type.
+ *  @param   container  A container.
+ *  @param   searcher   Compiled sequence to remove.
+ *  @param   output     The output iterator to write to.
+ *  @return  Iterator past the last written element.
+ *
+ *  @see  cu::filter_out_seq.
+ */
+template<cu_compatible Container, cu_compatible Pattern,
+    std::output_iterator<const value_type<Container> &> Output>
+requires(std::is_same_v<value_type<Container>, value_type<Pattern>>)
+inline constexpr auto filter_out_seq_into(
+    const Container         &container,
+    const searcher<Pattern> &searcher,
+    Output                   output
+) -> Output
+{
+    for (auto piece : views::split_seq(container, searcher))
+    {
+        output = std::copy(piece.begin(), piece.end(), output);
+    }
+    return output;
+}
+
+/**
+ *  @brief  Copy the container without the occurrences of sequence.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @tparam  Pattern    A compatible container type of pattern.
+ *  @tparam  Allocator  The allocator type of the vector.
+ *  @param   container  A container.
+ *  @param   searcher   Compiled sequence to remove.
+ *  @param   output     The vector to append to.
+ *  @return  Iterator past the last appended element.
+ *
+ *  @see  cu::filter_out_seq.
+ */
+template<cu_compatible Container, cu_compatible Pattern, typename Allocator>
+requires(std::is_same_v<value_type<Container>, value_type<Pattern>>)
+inline constexpr auto filter_out_seq_into(
+    const Container                               &container,
+    const searcher<Pattern>                       &searcher,
+    std::vector<value_type<Container>, Allocator> &output
+)
+{
+    filter_out_seq_into(container, searcher, std::back_inserter(output));
+    return output.end();
+}
+
+/**
+ *  @brief  Copy the container without the occurrences of any of values.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @tparam  Output     An output iterator type.
+ *  @param   container  A container.
+ *  @param   values     The elements to remove.
+ *  @param   output     The output iterator to write to.
+ *  @return  Iterator past the last written element.
+ *
+ *  @see  cu::filter_out_occ.
+ */
+template<cu_compatible Container,
+    std::output_iterator<const value_type<Container> &> Output>
+inline constexpr auto filter_out_occ_into(
+    const Container &container,
+    const Container &values,
+    Output           output
+) -> Output
+{
+    using T = value_type<Container>;
+
+    if constexpr (byte_like<T>)
+    {
+        // Copy the runs between the values found with byte_set
+        for (auto piece : views::split_occ(container, values))
+        {
+            output = std::copy(piece.begin(), piece.end(), output);
+        }
+        return output;
+    }
+    else
+    {
+        auto filterer = [&](const T &element)
+        {
+            return std::ranges::find(values, element) != values.end();
+        };
+
+        return std::remove_copy_if(container.begin(), container.end(), output,
+            filterer);
+    }
+}
+
+/**
+ *  @brief  Copy the container without the occurrences of any of values.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @tparam  Allocator  The allocator type of the vector.
+ *  @param   container  A container.
+ *  @param   values     The elements to remove.
+ *  @param   output     The vector to append to.
+ *  @return  Iterator past the last appended element.
+ *
+ *  @see  cu::filter_out_occ.
+ */
+template<cu_compatible Container, typename Allocator>
+inline constexpr auto filter_out_occ_into(
+    const Container                               &container,
+    const Container                               &values,
+    std::vector<value_type<Container>, Allocator> &output
+)
+{
+    filter_out_occ_into(container, values, std::back_inserter(output));
+    return output.end();
+}
+
+/**
+ *  @brief  Copy the container without the occurrences of any of sequences.
+ *
+ *  @tparam  Container        A compatible container type.
+ *  @tparam  NestedContainer  A compatible container type nested container type.
+ *  @tparam  Output           An output iterator type.
+ *  @param   container        A container.
+ *  @param   patterns         The sequences to remove.
+ *  @param   output           The output iterator to write to.
+ *  @return  Iterator past the last written element.
+ *
+ *  @see  cu::filter_out_occ_seq.
+ */
+template<cu_compatible Container, cu_compatible_nested NestedContainer,
+    std::output_iterator<const value_type<Container> &> Output>
+inline constexpr auto filter_out_occ_seq_into(
+    const Container       &container,
+    const NestedContainer &patterns,
+    Output                 output
+) -> Output
+{
+    return filter_out_occ_seq_into(container,
+        multi_searcher<value_type<NestedContainer>>(patterns), output);
+}
+
+/**
+ *  @brief  Copy the container without the occurrences of any of sequences.
+ *
+ *  @tparam  Container        A compatible container type.
+ *  @tparam  NestedContainer  A compatible container type nested container type.
+ *  @tparam  Allocator        The allocator type of the vector.
+ *  @param   container        A container.
+ *  @param   patterns         The sequences to remove.
+ *  @param   output           The vector to append to.
+ *  @return  Iterator past the last appended element.
+ *
+ *  @see  cu::filter_out_occ_seq.
+ */
+template<cu_compatible Container, cu_compatible_nested NestedContainer,
+    typename Allocator>
+inline constexpr auto filter_out_occ_seq_into(
+    const Container                               &container,
+    const NestedContainer                         &patterns,
+    std::vector<value_type<Container>, Allocator> &output
+)
+{
+    filter_out_occ_seq_into(container, patterns, std::back_inserter(output));
+    return output.end();
+}
+
+/**
+ *  @brief  Copy the container without the occurrences of any of sequences.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @tparam  Pattern    A compatible container type of pattern.
+ *  @tparam  Output     An output iterator type.
+ *  @param   container  A container.
+ *  @param   searcher   Compiled sequences to remove.
+ *  @param   output     The output iterator to write to.
+ *  @return  Iterator past the last written element.
+ *
+ *  @see  cu::filter_out_occ_seq.
+ */
+template<cu_compatible Container, cu_compatible Pattern,
+    std::output_iterator<const value_type<Container> &> Output>
+requires(std::is_same_v<value_type<Container>, value_type<Pattern>>)
+inline constexpr auto filter_out_occ_seq_into(
+    const Container               &container,
+    const multi_searcher<Pattern> &searcher,
+    Output                         output
+) -> Output
+{
+    for (auto piece : views::split_occ_seq(container, searcher))
+    {
+        output = std::copy(piece.begin(), piece.end(), output);
+    }
+    return output;
+}
+
+/**
+ *  @brief  Copy the container without the occurrences of any of sequences.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @tparam  Pattern    A compatible container type of pattern.
+ *  @tparam  Allocator  The allocator type of the vector.
+ *  @param   container  A container.
+ *  @param   searcher   Compiled sequences to remove.
+ *  @param   output     The vector to append to.
+ *  @return  Iterator past the last appended element.
+ *
+ *  @see  cu::filter_out_occ_seq.
+ */
+template<cu_compatible Container, cu_compatible Pattern, typename Allocator>
+requires(std::is_same_v<value_type<Container>, value_type<Pattern>>)
+inline constexpr auto filter_out_occ_seq_into(
+    const Container                               &container,
+    const multi_searcher<Pattern>                 &searcher,
+    std::vector<value_type<Container>, Allocator> &output
+)
+{
+    filter_out_occ_seq_into(container, searcher, std::back_inserter(output));
+    return output.end();
+}
+
+/**
+ *  @brief  Copy the container without the occurrences of value.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @tparam  Output     An output iterator type.
+ *  @param   container  A container.
+ *  @param   value      A value to remove.
+ *  @param   output     The output iterator to write to.
+ *  @return  Iterator past the last written element.
+ *
+ *  @see  cu::filter_out.
+ */
+template<cu_compatible Container,
+    std::output_iterator<const value_type<Container> &> Output>
+inline constexpr auto filter_out_into(
+    const Container             &container,
+    const value_type<Container> &value,
+    Output                       output
+) -> Output
+{
+    return std::remove_copy(container.begin(), container.end(), output,
+        value);
+}
+
+/**
+ *  @brief  Copy the container without the occurrences of value.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @tparam  Allocator  The allocator type of the vector.
+ *  @param   container  A container.
+ *  @param   value      A value to remove.
+ *  @param   output     The vector to append to.
+ *  @return  Iterator past the last appended element.
+ *
+ *  @see  cu::filter_out.
+ */
+template<cu_compatible Container, typename Allocator>
+inline constexpr auto filter_out_into(
+    const Container                               &container,
+    const value_type<Container>                   &value,
+    std::vector<value_type<Container>, Allocator> &output
+)
+{
+    filter_out_into(container, value, std::back_inserter(output));
+    return output.end();
+}
+
+/**
+ *  @brief  Copy container @c n times.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @tparam  Number     An arithmetic type.
+ *  @tparam  Output     An output iterator type.
+ *  @param   container  A container.
+ *  @param   n          The number of times to repeat.
+ *  @param   output     The output iterator to write to.
+ *  @return  Iterator past the last written element.
+ *
+ *  @see  cu::repeat.
+ */
+template<cu_compatible Container, typename Number,
+    std::output_iterator<const value_type<Container> &> Output>
+requires(std::is_arithmetic_v<Number>)
+inline constexpr auto repeat_into(
+    const Container &container,
+    Number           n,
+    Output           output
+) -> Output
+{
+    auto [regular_repeat, sub_size] =
+        impl::repeat_counts(container.size(), n);
+
+    for (std::size_t i = 0; i < regular_repeat; i++)
+    {
+        output = std::copy(container.begin(), container.end(), output);
+    }
+    return std::copy(container.begin(), container.begin() + sub_size, output);
+}
+
+/**
+ *  @brief  Copy container @c n times.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @tparam  Number     An arithmetic type.
+ *  @tparam  Allocator  The allocator type of the vector.
+ *  @param   container  A container.
+ *  @param   n          The number of times to repeat.
+ *  @param   output     The vector to append to.
+ *  @return  Iterator past the last appended element.
+ *
+ *  @see  cu::repeat.
+ */
+template<cu_compatible Container, typename Number, typename Allocator>
+requires(std::is_arithmetic_v<Number>)
+inline constexpr auto repeat_into(
+    const Container                               &container,
+    Number                                         n,
+    std::vector<value_type<Container>, Allocator> &output
+)
+{
+    output.reserve(output.size() + repeat_size(container.size(), n));
+    repeat_into(container, n, std::back_inserter(output));
+    return output.end();
+}
+
+/**
+ *  @brief  Remove the occurrences of sequence from the container, in place.
+ *
+ *  @tparam  Container  A compatible resizable container type.
+ *  @param   container  A container.
+ *  @param   pattern    A sequence to remove.
+ *  @return  The number of removed elements.
+ *
+ *  @see  cu::filter_out_seq.
+ */
+template<cu_compatible_resizable Container>
+inline constexpr auto filter_out_seq_inplace(
+    Container       &container,
+    const Container &pattern
+) -> std::size_t
+{
+    return filter_out_seq_inplace(container, searcher<Container>(pattern));
+}
+
+/**
+ *  @brief  Remove the occurrences of sequence from the container, in place.
+ *
+ *  @tparam  Container  A compatible resizable container type.
+ *  @tparam  Pattern    A compatible container type of pattern.
+ *  @param   container  A container.
+ *  @param   searcher   Compiled sequence to remove.
+ *  @return  The number of removed elements.
+ *
+ *  @see  cu::filter_out_seq.
+ */
+template<cu_compatible_resizable Container, cu_compatible Pattern>
+requires(std::is_same_v<value_type<Container>, value_type<Pattern>>)
+inline constexpr auto filter_out_seq_inplace(
+    Container               &container,
+    const searcher<Pattern> &searcher
+) -> std::size_t
+{
+    return impl::compact(container, views::split_seq(container, searcher));
+}
+
+/**
+ *  @brief  Remove the occurrences of any of values from the container, in
+ *          place.
+ *
+ *  @tparam  Container  A compatible resizable container type.
+ *  @tparam  Values     A compatible container type of values.
+ *  @param   container  A container.
+ *  @param   values     The elements to remove.
+ *  @return  The number of removed elements.
+ *
+ *  @see  cu::filter_out_occ.
+ */
+template<cu_compatible_resizable Container, cu_compatible Values>
+requires(std::is_same_v<value_type<Container>, value_type<Values>>)
+inline constexpr auto filter_out_occ_inplace(
+    Container    &container,
+    const Values &values
+) -> std::size_t
+{
+    using T = value_type<Container>;
+
+    if constexpr (byte_like<T>)
+    {
+        using Matcher = views::occ_matcher<T>;
+        return impl::compact(container, views::split_view<T, Matcher>(
+            as_span(container), Matcher(as_span(values))));
+    }
+    else
+    {
+        auto filterer = [&](const T &element)
+        {
+            return std::ranges::find(values, element) != values.end();
+        };
+
+        auto end = std::remove_if(container.begin(), container.end(),
+            filterer);
+
+        std::size_t erased = container.end() - end;
+        container.erase(end, container.end());
+        return erased;
+    }
+}
+
+/**
+ *  @brief  Remove the occurrences of any of sequences from the container, in
+ *          place.
+ *
+ *  @tparam  Container        A compatible resizable container type.
+ *  @tparam  NestedContainer  A compatible container type nested container type.
+ *  @param   container        A container.
+ *  @param   patterns         The sequences to remove.
+ *  @return  The number of removed elements.
+ *
+ *  @see  cu::filter_out_occ_seq.
+ */
+template<cu_compatible_resizable Container,
+    cu_compatible_nested NestedContainer>
+inline constexpr auto filter_out_occ_seq_inplace(
+    Container             &container,
+    const NestedContainer &patterns
+) -> std::size_t
+{
+    return filter_out_occ_seq_inplace(container,
+        multi_searcher<value_type<NestedContainer>>(patterns));
+}
+
+/**
+ *  @brief  Remove the occurrences of any of sequences from the container, in
+ *          place.
+ *
+ *  @tparam  Container  A compatible resizable container type.
+ *  @tparam  Pattern    A compatible container type of pattern.
+ *  @param   container  A container.
+ *  @param   searcher   Compiled sequences to remove.
+ *  @return  The number of removed elements.
+ *
+ *  @see  cu::filter_out_occ_seq.
+ */
+template<cu_compatible_resizable Container, cu_compatible Pattern>
+requires(std::is_same_v<value_type<Container>, value_type<Pattern>>)
+inline constexpr auto filter_out_occ_seq_inplace(
+    Container                     &container,
+    const multi_searcher<Pattern> &searcher
+) -> std::size_t
+{
+    return impl::compact(container,
+        views::split_occ_seq(container, searcher));
+}
+
+/**
+ *  @brief  Remove the occurrences of value from the container, in place.
+ *
+ *  @tparam  Container  A compatible resizable container type.
+ *  @param   container  A container.
+ *  @param   value      A value to remove.
+ *  @return  The number of removed elements.
+ *
+ *  @see  cu::filter_out.
+ */
+template<cu_compatible_resizable Container>
+inline constexpr auto filter_out_inplace(
+    Container                   &container,
+    const value_type<Container> &value
+) -> std::size_t
+{
+    auto end = std::remove(container.begin(), container.end(), value);
+
+    std::size_t erased = container.end() - end;
+    container.erase(end, container.end());
+    return erased;
+}
+
+/**
+ *  @brief  Repeat the container @c n times, in place.
+ *
+ *  @tparam  Container  A compatible resizable container type.
+ *  @tparam  Number     An arithmetic type.
+ *  @param   container  A container.
+ *  @param   n          The number of times to repeat.
+ *
+ *  @see  cu::repeat.
+ */
+template<cu_compatible_resizable Container, typename Number>
+requires(std::is_arithmetic_v<Number>)
+inline constexpr auto repeat_inplace(Container &container, Number n)
+{
+    std::size_t size = container.size();
+    auto [regular_repeat, sub_size] = impl::repeat_counts(size, n);
+
+    if (regular_repeat == 0)
+    {
+        container.erase(container.begin() + sub_size, container.end());
+        return;
+    }
+
+    // Elements are copied by index from a fresh begin, as appending may
+    // still invalidate iterators, such as with std::basic_string
+    container.reserve(repeat_size(size, n));
+    for (std::size_t i = 1; i < regular_repeat; i++)
+    {
+        for (std::size_t j = 0; j < size; j++)
+        {
+            container.push_back(*std::ranges::next(container.begin(), j));
+        }
+    }
+    for (std::size_t j = 0; j < sub_size; j++)
+    {
+        container.push_back(*std::ranges::next(container.begin(), j));
+    }
+}
+
+/**
+ *  @brief  Split the container with pattern, reusing its buffer.
+ *
+ *  The pattern occurrences are removed in place and the container's buffer
+ *  becomes the values of the result.
+ *
+ *  @tparam  T          The element type.
+ *  @tparam  Allocator  The allocator type.
+ *  @param   container  A container to split, moved from.
+ *  @param   pattern    A pattern to split with.
+ *  @return  Split container as @c jagged .
+ *
+ *  @see  cu::split_seq.
+ */
+template<typename T, typename Allocator>
+[[nodiscard]] inline constexpr auto split_seq_inplace(
+    std::vector<T, Allocator>       &&container,
+    const std::vector<T, Allocator> &pattern
+)
+{
+    return split_seq_inplace(std::move(container),
+        searcher<std::vector<T, Allocator>>(pattern));
+}
+
+/**
+ *  @brief  Split the container with pattern, reusing its buffer.
+ *
+ *  @tparam  T          The element type.
+ *  @tparam  Allocator  The allocator type.
+ *  @tparam  Pattern    A compatible container type of pattern.
+ *  @param   container  A container to split, moved from.
+ *  @param   searcher   Compiled pattern to split with.
+ *  @return  Split container as @c jagged .
+ *
+ *  @see  cu::split_seq.
+ */
+template<typename T, typename Allocator, cu_compatible Pattern>
+requires(std::is_same_v<T, value_type<Pattern>>)
+[[nodiscard]] inline constexpr auto split_seq_inplace(
+    std::vector<T, Allocator> &&container,
+    const searcher<Pattern>   &searcher
+)
+{
+    return impl::compact_jagged(container,
+        views::split_seq(container, searcher));
+}
+
+/**
+ *  @brief  Split the container with any of values, reusing its buffer.
+ *
+ *  @tparam  T          The element type.
+ *  @tparam  Allocator  The allocator type.
+ *  @param   container  A container to split, moved from.
+ *  @param   values     The values to split with.
+ *  @return  Split container as @c jagged .
+ *
+ *  @see  cu::split_occ.
+ */
+template<typename T, typename Allocator>
+[[nodiscard]] inline constexpr auto split_occ_inplace(
+    std::vector<T, Allocator>       &&container,
+    const std::vector<T, Allocator> &values
+)
+{
+    return impl::compact_jagged(container,
+        views::split_occ(container, values));
+}
+
+/**
+ *  @brief  Split the container with any of patterns, reusing its buffer.
+ *
+ *  @tparam  T                The element type.
+ *  @tparam  Allocator        The allocator type.
+ *  @tparam  NestedContainer  A compatible container type nested container type.
+ *  @param   container        A container to split, moved from.
+ *  @param   patterns         The patterns to split with.
+ *  @return  Split container as @c jagged .
+ *
+ *  @see  cu::split_occ_seq.
+ */
+template<typename T, typename Allocator,
+    cu_compatible_nested NestedContainer>
+[[nodiscard]] inline constexpr auto split_occ_seq_inplace(
+    std::vector<T, Allocator> &&container,
+    const NestedContainer      &patterns
+)
+{
+    return split_occ_seq_inplace(std::move(container),
+        multi_searcher<value_type<NestedContainer>>(patterns));
+}
+
+/**
+ *  @brief  Split the container with any of patterns, reusing its buffer.
+ *
+ *  @tparam  T          The element type.
+ *  @tparam  Allocator  The allocator type.
+ *  @tparam  Pattern    A compatible container type of pattern.
+ *  @param   container  A container to split, moved from.
+ *  @param   searcher   Compiled patterns to split with.
+ *  @return  Split container as @c jagged .
+ *
+ *  @see  cu::split_occ_seq.
+ */
+template<typename T, typename Allocator, cu_compatible Pattern>
+requires(std::is_same_v<T, value_type<Pattern>>)
+[[nodiscard]] inline constexpr auto split_occ_seq_inplace(
+    std::vector<T, Allocator>     &&container,
+    const multi_searcher<Pattern> &searcher
+)
+{
+    return impl::compact_jagged(container,
+        views::split_occ_seq(container, searcher));
+}
+
+/**
+ *  @brief  Split the container with value, reusing its buffer.
+ *
+ *  @tparam  T          The element type.
+ *  @tparam  Allocator  The allocator type.
+ *  @param   container  A container to split, moved from.
+ *  @param   value      A value to split with.
+ *  @return  Split container as @c jagged .
+ *
+ *  @see  cu::split.
+ */
+template<typename T, typename Allocator>
+[[nodiscard]] inline constexpr auto split_inplace(
+    std::vector<T, Allocator>     &&container,
+    const std::type_identity_t<T> &value
+)
+{
+    return impl::compact_jagged(container, views::split(container, value));
+}
+
+/**
+ *  @brief  Get the subset of the container's elements.
+ *
+ *  @tparam  Container        A compatible container type.
+ *  @tparam  Allocator        An allocator type, or @c std::pmr::memory_resource
+ *                            pointer type.
+ *  @param   container        A container.
+ *  @param   first_inclusive  The first index (inclusive).
+ *  @param   last_exclusive   The last index (exclusive).
+ *  @param   allocator        The allocator of the result.
+ *  @return  Subset of the container as @c result_container .
+ */
+template<cu_compatible Container,
+    typename Allocator = std::allocator<value_type<Container>>>
+[[nodiscard]] inline constexpr auto subordinate(
+    const Container &container,
+    std::size_t      first_inclusive,
+    std::size_t      last_exclusive,
+    const Allocator &allocator = Allocator()
+)
+{
+    return result_container<Container, Allocator>(
+        container.begin() + first_inclusive,
+        container.begin() + last_exclusive,
+        make_allocator<value_type<Container>>(allocator));
+}
+
+/**
+ *  @brief  Copy containers into one container.
+ *
+ *  @tparam  Container    A compatible container type.
+ *  @tparam  Allocator    An allocator type, or @c std::pmr::memory_resource
+ *                        pointer type.
+ *  @param   container_a  The first container.
+ *  @param   container_b  The second container.
+ *  @param   allocator    The allocator of the result.
+ *  @return  Combined container as @c result_container .
+ */
+template<cu_compatible Container,
+    typename Allocator = std::allocator<value_type<Container>>>
+[[nodiscard]] inline constexpr auto combine(
+    const Container &container_a,
+    const Container &container_b,
+    const Allocator &allocator = Allocator()
+)
+{
+    result_container<Container, Allocator> result(container_a.begin(),
+        container_a.end(), make_allocator<value_type<Container>>(allocator));
+    result.insert(result.end(), container_b.begin(), container_b.end());
+    return result;
+}
+
+/**
  *  @brief  Copy containers into one container.
  *
- *  @tparam  Container    A compatible container type.
- *  @param   container_a  The first container.
- *  @param   container_b  The second container.
- *  @return  Combined container as @c result_container .
+ *  @tparam  Result       The container type to return, such as
+ *                        @c small_vector .
+ *  @tparam  Container    A compatible container type.
+ *  @param   container_a  The first container.
+ *  @param   container_b  The second container.
+ *  @return  Combined container as @c Result .
+ */
+template<typename Result, cu_compatible Container>
+requires(!std::is_same_v<Result, Container>)
+[[nodiscard]] inline constexpr auto combine(
+    const Container &container_a,
+    const Container &container_b
+) -> Result
+{
+    auto result = impl::reserved<Result>(container_a.size()
+        + container_b.size());
+    combine_into(container_a, container_b, std::back_inserter(result));
+    return result;
+}
+
+/**
+ *  @brief  Copy container and value into one container.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @tparam  Allocator  An allocator type, or @c std::pmr::memory_resource
+ *                      pointer type.
+ *  @param   container  A container.
+ *  @param   value      A value of container's value type.
+ *  @param   allocator  The allocator of the result.
+ *  @return  Value-appended container as @c result_container .
+ */
+template<cu_compatible Container,
+    typename Allocator = std::allocator<value_type<Container>>>
+[[nodiscard]] inline constexpr auto combine(
+    const Container             &container,
+    const value_type<Container> &value,
+    const Allocator             &allocator = Allocator()
+)
+{
+    result_container<Container, Allocator> result(container.begin(),
+        container.end(), make_allocator<value_type<Container>>(allocator));
+    result.push_back(value);
+    return result;
+}
+
+/**
+ *  @brief  Filter out the occurrences of sequence from the container.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @tparam  Allocator  An allocator type, or @c std::pmr::memory_resource
+ *                      pointer type.
+ *  @param   container  A container.
+ *  @param   pattern    A sequence to remove.
+ *  @param   allocator  The allocator of the result.
+ *  @return  Filtered container as @c result_container .
+ */
+template<cu_compatible Container,
+    typename Allocator = std::allocator<value_type<Container>>>
+[[nodiscard]] inline constexpr auto filter_out_seq(
+    const Container &container,
+    const Container &pattern,
+    const Allocator &allocator = Allocator()
+)
+{
+    return filter_out_seq(container, searcher<Container>(pattern), allocator);
+}
+
+/**
+ *  @brief  Filter out the occurrences of sequence from the container.
+ *
+ *  @tparam  Result     The container type to return, such as
+ *                      @c small_vector .
+ *  @tparam  Container  A compatible container type.
+ *  @param   container  A container.
+ *  @param   pattern    A sequence to remove.
+ *  @return  Filtered container as @c Result .
+ */
+template<typename Result, cu_compatible Container>
+requires(!std::is_same_v<Result, Container>)
+[[nodiscard]] inline constexpr auto filter_out_seq(
+    const Container &container,
+    const Container &pattern
+) -> Result
+{
+    searcher<Container> compiled(pattern);
+
+    auto result = impl::reserved<Result>(
+        filtered_size_seq(container, compiled));
+    filter_out_seq_into(container, compiled, std::back_inserter(result));
+    return result;
+}
+
+/**
+ *  @brief  Filter out the occurrences of sequence from the container.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @tparam  Pattern    A compatible container type of pattern.
+ *  @tparam  Allocator  An allocator type, or @c std::pmr::memory_resource
+ *                      pointer type.
+ *  @param   container  A container.
+ *  @param   searcher   Compiled sequence to remove.
+ *  @param   allocator  The allocator of the result.
+ *  @return  Filtered container as @c result_container .
+ */
+template<cu_compatible Container, cu_compatible Pattern,
+    typename Allocator = std::allocator<value_type<Container>>>
+requires(std::is_same_v<value_type<Container>, value_type<Pattern>>)
+[[nodiscard]] inline constexpr auto filter_out_seq(
+    const Container         &container,
+    const searcher<Pattern> &searcher,
+    const Allocator         &allocator = Allocator()
+)
+{
+    result_container<Container, Allocator> result(
+        make_allocator<value_type<Container>>(allocator));
+    result.reserve(filtered_size_seq(container, searcher));
+    filter_out_seq_into(container, searcher, std::back_inserter(result));
+    return result;
+}
+
+/**
+ *  @brief  Filter out the occurrences of any of values from the container.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @tparam  Allocator  An allocator type, or @c std::pmr::memory_resource
+ *                      pointer type.
+ *  @param   container  A container.
+ *  @param   values     The elements to remove.
+ *  @param   allocator  The allocator of the result.
+ *  @return  Filtered container as @c result_container .
+ */
+template<cu_compatible Container,
+    typename Allocator = std::allocator<value_type<Container>>>
+[[nodiscard]] inline constexpr auto filter_out_occ(
+    const Container &container,
+    const Container &values,
+    const Allocator &allocator = Allocator()
+)
+{
+    result_container<Container, Allocator> result(
+        make_allocator<value_type<Container>>(allocator));
+    result.reserve(filtered_size_occ(container, values));
+    filter_out_occ_into(container, values, std::back_inserter(result));
+    return result;
+}
+
+/**
+ *  @brief  Filter out the occurrences of any of values from the container.
+ *
+ *  @tparam  Result     The container type to return, such as
+ *                      @c small_vector .
+ *  @tparam  Container  A compatible container type.
+ *  @param   container  A container.
+ *  @param   values     The elements to remove.
+ *  @return  Filtered container as @c Result .
+ */
+template<typename Result, cu_compatible Container>
+requires(!std::is_same_v<Result, Container>)
+[[nodiscard]] inline constexpr auto filter_out_occ(
+    const Container &container,
+    const Container &values
+) -> Result
+{
+    auto result = impl::reserved<Result>(
+        filtered_size_occ(container, values));
+    filter_out_occ_into(container, values, std::back_inserter(result));
+    return result;
+}
+
+/**
+ *  @brief  Filter out the occurrences of any of sequences from the container.
+ *
+ *  @tparam  Container        A compatible container type.
+ *  @tparam  NestedContainer  A compatible container type nested container type.
+ *  @tparam  Allocator        An allocator type, or @c std::pmr::memory_resource
+ *                            pointer type.
+ *  @param   container        A container.
+ *  @param   patterns         The sequences to remove.
+ *  @param   allocator        The allocator of the result.
+ *  @return  Filtered container as @c result_container .
+ */
+template<cu_compatible Container, cu_compatible_nested NestedContainer,
+    typename Allocator = std::allocator<value_type<Container>>>
+[[nodiscard]] inline constexpr auto filter_out_occ_seq(
+    const Container       &container,
+    const NestedContainer &patterns,
+    const Allocator       &allocator = Allocator()
+)
+{
+    return filter_out_occ_seq(container,
+        multi_searcher<value_type<NestedContainer>>(patterns), allocator);
+}
+
+/**
+ *  @brief  Filter out the occurrences of any of sequences from the container.
+ *
+ *  @tparam  Result           The container type to return, such as
+ *                            @c small_vector .
+ *  @tparam  Container        A compatible container type.
+ *  @tparam  NestedContainer  A compatible container type nested container type.
+ *  @param   container        A container.
+ *  @param   patterns         The sequences to remove.
+ *  @return  Filtered container as @c Result .
+ */
+template<typename Result, cu_compatible Container,
+    cu_compatible_nested NestedContainer>
+requires(!std::is_same_v<Result, Container>)
+[[nodiscard]] inline constexpr auto filter_out_occ_seq(
+    const Container       &container,
+    const NestedContainer &patterns
+) -> Result
+{
+    multi_searcher<value_type<NestedContainer>> compiled(patterns);
+
+    auto result = impl::reserved<Result>(
+        filtered_size_occ_seq(container, compiled));
+    filter_out_occ_seq_into(container, compiled, std::back_inserter(result));
+    return result;
+}
+
+/**
+ *  @brief  Filter out the occurrences of any of sequences from the container.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @tparam  Pattern    A compatible container type of pattern.
+ *  @tparam  Allocator  An allocator type, or @c std::pmr::memory_resource
+ *                      pointer type.
+ *  @param   container  A container.
+ *  @param   searcher   Compiled sequences to remove.
+ *  @param   allocator  The allocator of the result.
+ *  @return  Filtered container as @c result_container .
+ */
+template<cu_compatible Container, cu_compatible Pattern,
+    typename Allocator = std::allocator<value_type<Container>>>
+requires(std::is_same_v<value_type<Container>, value_type<Pattern>>)
+[[nodiscard]] inline constexpr auto filter_out_occ_seq(
+    const Container               &container,
+    const multi_searcher<Pattern> &searcher,
+    const Allocator               &allocator = Allocator()
+)
+{
+    result_container<Container, Allocator> result(
+        make_allocator<value_type<Container>>(allocator));
+    result.reserve(filtered_size_occ_seq(container, searcher));
+    filter_out_occ_seq_into(container, searcher, std::back_inserter(result));
+    return result;
+}
+
+/**
+ *  @brief  Filter out the occurrences of value from the container.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @tparam  Allocator  An allocator type, or @c std::pmr::memory_resource
+ *                      pointer type.
+ *  @param   container  A container.
+ *  @param   value      A value to remove.
+ *  @param   allocator  The allocator of the result.
+ *  @return  Filtered container as @c result_container .
+ */
+template<cu_compatible Container,
+    typename Allocator = std::allocator<value_type<Container>>>
+[[nodiscard]] inline constexpr auto filter_out(
+    const Container             &container,
+    const value_type<Container> &value,
+    const Allocator             &allocator = Allocator()
+)
+{
+    result_container<Container, Allocator> result(
+        make_allocator<value_type<Container>>(allocator));
+    result.reserve(filtered_size(container, value));
+    std::remove_copy(container.begin(), container.end(),
+        std::back_inserter(result), value);
+    return result;
+}
+
+/**
+ *  @brief  Filter out the occurrences of value from the container.
+ *
+ *  @tparam  Result     The container type to return, such as
+ *                      @c small_vector .
+ *  @tparam  Container  A compatible container type.
+ *  @param   container  A container.
+ *  @param   value      A value to remove.
+ *  @return  Filtered container as @c Result .
+ */
+template<typename Result, cu_compatible Container>
+requires(!std::is_same_v<Result, Container>)
+[[nodiscard]] inline constexpr auto filter_out(
+    const Container             &container,
+    const value_type<Container> &value
+) -> Result
+{
+    auto result = impl::reserved<Result>(filtered_size(container, value));
+    filter_out_into(container, value, std::back_inserter(result));
+    return result;
+}
+
+/**
+ *  @brief  Repeat container @c n times.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @tparam  Allocator  An allocator type, or @c std::pmr::memory_resource
+ *                      pointer type.
+ *  @param   container  A container.
+ *  @param   n          The number of times to repeat.
+ *  @param   allocator  The allocator of the result.
+ *  @return  Repeated container as @c result_container .
+ */
+template<cu_compatible Container,
+    typename Allocator = std::allocator<value_type<Container>>>
+[[nodiscard]] inline constexpr auto repeat(
+    const Container &container,
+    std::size_t      n,
+    const Allocator &allocator = Allocator()
+)
+{
+    result_container<Container, Allocator> result(
+        make_allocator<value_type<Container>>(allocator));
+    repeat_into(container, n, result);
+    return result;
+}
+
+/**
+ *  @brief  Repeat container @c n times.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @tparam  Allocator  An allocator type, or @c std::pmr::memory_resource
+ *                      pointer type.
+ *  @param   container  A container.
+ *  @param   n          The number of times to repeat.
+ *  @param   allocator  The allocator of the result.
+ *  @return  Repeated container as @c result_container .
+ *
+ *  @see  @c std::size_t overload of @c repeat .
+ */
+template<cu_compatible Container,
+    typename Allocator = std::allocator<value_type<Container>>>
+[[nodiscard]] inline constexpr auto repeat(
+    const Container &container,
+    int              n,
+    const Allocator &allocator = Allocator()
+)
+{
+    // Performance-critical, don't use exceptions
+    if (n < 0) n = 0;
+    return repeat(container, (std::size_t)n, allocator);
+}
+
+/**
+ *  @brief  Repeat container @c n times.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @tparam  Allocator  An allocator type, or @c std::pmr::memory_resource
+ *                      pointer type.
+ *  @param   container  A container.
+ *  @param   n          The number of times to repeat.
+ *  @param   allocator  The allocator of the result.
+ *  @return  Repeated container as @c result_container .
+ *
+ *  @see  @c std::size_t overload of @c repeat .
+ */
+template<cu_compatible Container,
+    typename Allocator = std::allocator<value_type<Container>>>
+[[nodiscard]] inline constexpr auto repeat(
+    const Container &container,
+    unsigned         n,
+    const Allocator &allocator = Allocator()
+)
+{
+    return repeat(container, (std::size_t)n, allocator);
+}
+
+/**
+ *  @brief  Repeat container @c n times.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @tparam  Allocator  An allocator type, or @c std::pmr::memory_resource
+ *                      pointer type.
+ *  @param   container  A container.
+ *  @param   n          The number of times to repeat.
+ *  @param   allocator  The allocator of the result.
+ *  @return  Repeated container as @c result_container .
+ *
+ *  @see  @c std::size_t overload of @c repeat .
+ */
+template<cu_compatible Container,
+    typename Allocator = std::allocator<value_type<Container>>>
+[[nodiscard]] inline constexpr auto repeat(
+    const Container &container,
+    long             n,
+    const Allocator &allocator = Allocator()
+)
+{
+    // Performance-critical, don't use exceptions
+    if (n < 0) n = 0;
+    return repeat(container, (std::size_t)n, allocator);
+}
+
+/**
+ *  @brief  Repeat container @c n times.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @tparam  Allocator  An allocator type, or @c std::pmr::memory_resource
+ *                      pointer type.
+ *  @param   container  A container.
+ *  @param   n          The number of times to repeat.
+ *  @param   allocator  The allocator of the result.
+ *  @return  Repeated container as @c result_container .
+ *
+ *  @see  @c std::size_t overload of @c repeat .
+ */
+template<cu_compatible Container,
+    typename Allocator = std::allocator<value_type<Container>>>
+[[nodiscard]] inline constexpr auto repeat(
+    const Container &container,
+    long long        n,
+    const Allocator &allocator = Allocator()
+)
+{
+    // Performance-critical, don't use exceptions
+    if (n < 0) n = 0;
+    return repeat(container, (std::size_t)n, allocator);
+}
+
+/**
+ *  @brief  Repeat container @c n times.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @tparam  Allocator  An allocator type, or @c std::pmr::memory_resource
+ *                      pointer type.
+ *  @param   container  A container.
+ *  @param   n          The number of times to repeat.
+ *  @param   allocator  The allocator of the result.
+ *  @return  Repeated container as @c result_container .
+ *
+ *  @see  @c std::size_t overload of @c repeat .
  */
-template<cu_compatible Container>
-[[nodiscard]] inline constexpr auto combine(
-    const Container &container_a,
-    const Container &container_b
+template<cu_compatible Container,
+    typename Allocator = std::allocator<value_type<Container>>>
+[[nodiscard]] inline constexpr auto repeat(
+    const Container   &container,
+    unsigned long long n,
+    const Allocator   &allocator = Allocator()
 )
 {
-    return result_container_nested<Container> {
-        result_container<Container>(container_a.begin(), container_a.end()),
-        result_container<Container>(container_b.begin(), container_b.end())
-    } | std::views::join
-      | std::ranges::to<result_container<Container>>();
+    return repeat(container, (std::size_t)n, allocator);
 }
 
 /**
- *  @brief  Copy container and value into one container.
+ *  @brief  Repeat container @c n times.
+ *
+ *  Considering integer part of the number @c n as @c i, and fraction part as
+ *  @c f. The container is repeated @c i.0 times, and then the container is
+ *  added with subordinate container with `round(0.f * container.size())`
+ *  elements from the beginning.
  *
  *  @tparam  Container  A compatible container type.
+ *  @tparam  Allocator  An allocator type, or @c std::pmr::memory_resource
+ *                      pointer type.
  *  @param   container  A container.
- *  @param   value      A value of container's value type.
- *  @return  Value-appended container as @c result_container .
+ *  @param   n          The number of times to repeat.
+ *  @param   allocator  The allocator of the result.
+ *  @return  Repeated container as @c result_container .
+ *
+ *  @note  This is scuffed.
  */
-template<cu_compatible Container>
-[[nodiscard]] inline constexpr auto combine(
+template<cu_compatible Container,
+    typename Allocator = std::allocator<value_type<Container>>>
+[[nodiscard]] inline constexpr auto repeat(
+    const Container &container,
+    long double      n,
+    const Allocator &allocator = Allocator()
+)
+{
+    result_container<Container, Allocator> result(
+        make_allocator<value_type<Container>>(allocator));
+    repeat_into(container, n, result);
+    return result;
+}
+
+/**
+ *  @brief  Repeat container @c n times.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @tparam  Allocator  An allocator type, or @c std::pmr::memory_resource
+ *                      pointer type.
+ *  @param   container  A container.
+ *  @param   n          The number of times to repeat.
+ *  @param   allocator  The allocator of the result.
+ *  @return  Repeated container as @c result_container .
+ *
+ *  @note  This is scuffed.
+ *  @see  `long double` overload of @c repeat .
+ */
+template<cu_compatible Container,
+    typename Allocator = std::allocator<value_type<Container>>>
+[[nodiscard]] inline constexpr auto repeat(
+    const Container &container,
+    float            n,
+    const Allocator &allocator = Allocator()
+)
+{
+    return repeat(container, (long double)n, allocator);
+}
+
+/**
+ *  @brief  Repeat container @c n times.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @tparam  Allocator  An allocator type, or @c std::pmr::memory_resource
+ *                      pointer type.
+ *  @param   container  A container.
+ *  @param   n          The number of times to repeat.
+ *  @param   allocator  The allocator of the result.
+ *  @return  Repeated container as @c result_container .
+ *
+ *  @note  This is scuffed.
+ *  @see  `long double` overload of @c repeat .
+ */
+template<cu_compatible Container,
+    typename Allocator = std::allocator<value_type<Container>>>
+[[nodiscard]] inline constexpr auto repeat(
+    const Container &container,
+    double           n,
+    const Allocator &allocator = Allocator()
+)
+{
+    return repeat(container, (long double)n, allocator);
+}
+
+/**
+ *  @brief  Repeat container @c n times.
+ *
+ *  @tparam  Result     The container type to return, such as
+ *                      @c small_vector .
+ *  @tparam  Container  A compatible container type.
+ *  @tparam  Number     An arithmetic type.
+ *  @param   container  A container.
+ *  @param   n          The number of times to repeat.
+ *  @return  Repeated container as @c Result .
+ */
+template<typename Result, cu_compatible Container, typename Number>
+requires(!std::is_same_v<Result, Container> && std::is_arithmetic_v<Number>)
+[[nodiscard]] inline constexpr auto repeat(
+    const Container &container,
+    Number           n
+) -> Result
+{
+    auto result = impl::reserved<Result>(repeat_size(container.size(), n));
+    repeat_into(container, n, std::back_inserter(result));
+    return result;
+}
+
+/**
+ *  @brief  Split the container with pattern.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @tparam  Allocator  An allocator type, or @c std::pmr::memory_resource
+ *                      pointer type.
+ *  @param   container  A container.
+ *  @param   pattern    A pattern to split with.
+ *  @param   allocator  The allocator of the result.
+ *  @return  Split container as @c result_container_nested .
+ */
+template<cu_compatible Container,
+    typename Allocator = std::allocator<value_type<Container>>>
+[[nodiscard]] inline constexpr auto split_seq(
+    const Container &container,
+    const Container &pattern,
+    const Allocator &allocator = Allocator()
+)
+{
+    return split_seq(container, searcher<Container>(pattern), allocator);
+}
+
+/**
+ *  @brief  Split the container with pattern.
+ *
+ *  @tparam  Result     The container type to return, such as @c jagged .
+ *  @tparam  Container  A compatible container type.
+ *  @param   container  A container.
+ *  @param   pattern    A pattern to split with.
+ *  @return  Split container as @c Result .
+ */
+template<typename Result, cu_compatible Container>
+requires(!std::is_same_v<Result, Container>)
+[[nodiscard]] inline constexpr auto split_seq(
+    const Container &container,
+    const Container &pattern
+)
+{
+    return views::split_seq(container, searcher<Container>(pattern))
+         | std::ranges::to<Result>();
+}
+
+/**
+ *  @brief  Split the container with pattern.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @tparam  Pattern    A compatible container type of pattern.
+ *  @tparam  Allocator  An allocator type, or @c std::pmr::memory_resource
+ *                      pointer type.
+ *  @param   container  A container.
+ *  @param   searcher   Compiled pattern to split with.
+ *  @param   allocator  The allocator of the result.
+ *  @return  Split container as @c result_container_nested .
+ */
+template<cu_compatible Container, cu_compatible Pattern,
+    typename Allocator = std::allocator<value_type<Container>>>
+requires(std::is_same_v<value_type<Container>, value_type<Pattern>>)
+[[nodiscard]] inline constexpr auto split_seq(
+    const Container         &container,
+    const searcher<Pattern> &searcher,
+    const Allocator         &allocator = Allocator()
+)
+{
+    return impl::to_nested<result_container_nested<Container, Allocator>>(
+        views::split_seq(container, searcher), allocator);
+}
+
+/**
+ *  @brief  Split the container with occurrences of value.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @tparam  Allocator  An allocator type, or @c std::pmr::memory_resource
+ *                      pointer type.
+ *  @param   container  A container.
+ *  @param   values     The values to split with.
+ *  @param   allocator  The allocator of the result.
+ *  @return  Split container as @c result_container_nested .
+ */
+template<cu_compatible Container,
+    typename Allocator = std::allocator<value_type<Container>>>
+[[nodiscard]] inline constexpr auto split_occ(
+    const Container &container,
+    const Container &values,
+    const Allocator &allocator = Allocator()
+)
+{
+    return impl::to_nested<result_container_nested<Container, Allocator>>(
+        views::split_occ(container, values), allocator);
+}
+
+/**
+ *  @brief  Split the container with occurrences of value.
+ *
+ *  @tparam  Result     The container type to return, such as @c jagged .
+ *  @tparam  Container  A compatible container type.
+ *  @param   container  A container.
+ *  @param   values     The values to split with.
+ *  @return  Split container as @c Result .
+ */
+template<typename Result, cu_compatible Container>
+requires(!std::is_same_v<Result, Container>)
+[[nodiscard]] inline constexpr auto split_occ(
+    const Container &container,
+    const Container &values
+)
+{
+    return views::split_occ(container, values)
+         | std::ranges::to<Result>();
+}
+
+/**
+ *  @brief  Split the container with occurrences of any of pattern.
+ *
+ *  @tparam  Container        A compatible container type.
+ *  @tparam  NestedContainer  A compatible container type nested container type.
+ *  @tparam  Allocator        An allocator type, or @c std::pmr::memory_resource
+ *                            pointer type.
+ *  @param   container        A container.
+ *  @param   patterns         The patterns to split with.
+ *  @param   allocator        The allocator of the result.
+ *  @return  Split container as @c result_container_nested .
+ */
+template<cu_compatible Container, cu_compatible_nested NestedContainer,
+    typename Allocator = std::allocator<value_type<Container>>>
+[[nodiscard]] inline constexpr auto split_occ_seq(
+    const Container       &container,
+    const NestedContainer &patterns,
+    const Allocator       &allocator = Allocator()
+)
+{
+    return impl::to_nested<result_container_nested<Container, Allocator>>(
+        views::split_occ_seq(container, patterns), allocator);
+}
+
+/**
+ *  @brief  Split the container with occurrences of any of pattern.
+ *
+ *  @tparam  Result           The container type to return, such as @c jagged .
+ *  @tparam  Container        A compatible container type.
+ *  @tparam  NestedContainer  A compatible container type nested container type.
+ *  @param   container        A container.
+ *  @param   patterns         The patterns to split with.
+ *  @return  Split container as @c Result .
+ */
+template<typename Result, cu_compatible Container,
+    cu_compatible_nested NestedContainer>
+requires(!std::is_same_v<Result, Container>)
+[[nodiscard]] inline constexpr auto split_occ_seq(
+    const Container       &container,
+    const NestedContainer &patterns
+)
+{
+    return views::split_occ_seq(container, patterns)
+         | std::ranges::to<Result>();
+}
+
+/**
+ *  @brief  Split the container with occurrences of any of pattern.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @tparam  Pattern    A compatible container type of pattern.
+ *  @tparam  Allocator  An allocator type, or @c std::pmr::memory_resource
+ *                      pointer type.
+ *  @param   container  A container.
+ *  @param   searcher   Compiled patterns to split with.
+ *  @param   allocator  The allocator of the result.
+ *  @return  Split container as @c result_container_nested .
+ */
+template<cu_compatible Container, cu_compatible Pattern,
+    typename Allocator = std::allocator<value_type<Container>>>
+requires(std::is_same_v<value_type<Container>, value_type<Pattern>>)
+[[nodiscard]] inline constexpr auto split_occ_seq(
+    const Container               &container,
+    const multi_searcher<Pattern> &searcher,
+    const Allocator               &allocator = Allocator()
+)
+{
+    return impl::to_nested<result_container_nested<Container, Allocator>>(
+        views::split_occ_seq(container, searcher), allocator);
+}
+
+/**
+ *  @brief  Split the container with value.
+ *
+ *  @tparam  Container  A compatible container type.
+ *  @tparam  Allocator  An allocator type, or @c std::pmr::memory_resource
+ *                      pointer type.
+ *  @param   container  A container.
+ *  @param   value      A value to split with.
+ *  @param   allocator  The allocator of the result.
+ *  @return  Split container as @c result_container_nested .
+ */
+template<cu_compatible Container,
+    typename Allocator = std::allocator<value_type<Container>>>
+[[nodiscard]] inline constexpr auto split(
+    const Container             &container,
+    const value_type<Container> &value,
+    const Allocator             &allocator = Allocator()
+)
+{
+    return impl::to_nested<result_container_nested<Container, Allocator>>(
+        views::split(container, value), allocator);
+}
+
+/**
+ *  @brief  Split the container with value.
+ *
+ *  @tparam  Result     The container type to return, such as @c jagged .
+ *  @tparam  Container  A compatible container type.
+ *  @param   container  A container.
+ *  @param   value      A value to split with.
+ *  @return  Split container as @c Result .
+ */
+template<typename Result, cu_compatible Container>
+requires(!std::is_same_v<Result, Container>)
+[[nodiscard]] inline constexpr auto split(
     const Container             &container,
     const value_type<Container> &value
 )
 {
-    return combine(container, result_container<Container> { value });
+    return views::split(container, value)
+         | std::ranges::to<Result>();
 }
 
 /**
- *  @brief  Filter out the occurrences of sequence from the container.
+ *  @brief  Execution policies for the parallel overloads of Container
+ *          Utilities.
+ */
+namespace execution {
+
+/**
+ *  @brief  Run the algorithm serially on the calling thread.
+ */
+struct sequenced_policy {};
+
+/**
+ *  @brief  Run the algorithm on multiple threads for large containers.
+ */
+struct parallel_policy {
+
+    /**
+     *  @brief  The number of threads, or @c 0 to use up to one thread per
+     *          hardware thread depending on the size of container.
+     */
+    std::size_t threads = 0;
+
+    /**
+     *  @brief  Get the policy running on a number of threads regardless of
+     *          the size of container or the hardware.
+     *
+     *  @param  count  The number of threads.
+     *  @return  The policy with the number of threads.
+     */
+    [[nodiscard]] inline constexpr auto operator() (std::size_t count) const
+        -> parallel_policy
+    {
+        return parallel_policy { count };
+    }
+};
+
+/**
+ *  @brief  Instance of @c sequenced_policy .
+ */
+inline constexpr sequenced_policy seq = {};
+
+/**
+ *  @brief  Instance of @c parallel_policy .
+ */
+inline constexpr parallel_policy par = {};
+
+} // namespace execution
+
+/**
+ *  @brief  Execution policy of Container Utilities.
+ *  @tparam  Policy  The type to check.
+ */
+template<typename Policy>
+concept execution_policy =
+    std::is_same_v<std::remove_cvref_t<Policy>, execution::sequenced_policy>
+ || std::is_same_v<std::remove_cvref_t<Policy>, execution::parallel_policy>;
+
+/**
+ *  @brief  Minimum number of elements for each thread of the parallel
+ *          overloads.  Smaller containers are processed serially.
+ */
+inline constexpr std::size_t parallel_threshold = 1 << 16;
+
+namespace impl {
+
+/**
+ *  @brief  Get the number of chunks to process elements in parallel.
  *
- *  @tparam  Container  A compatible container type.
- *  @param   container  A container.
- *  @param   pattern    A sequence to remove.
- *  @return  Filtered container as @c result_container .
+ *  @tparam  Policy  An execution policy type.
+ *  @param   policy  The execution policy.
+ *  @param   size    The number of elements.
+ *  @return  The number of chunks, @c 1 to process serially.
  */
-template<cu_compatible Container>
-[[nodiscard]] inline constexpr auto filter_out_seq(
-    const Container &container,
-    const Container &pattern
-)
+template<execution_policy Policy>
+[[nodiscard]] inline auto parallel_chunks(
+    [[maybe_unused]] const Policy &policy,
+    std::size_t                    size
+) -> std::size_t
 {
-    return std::views::split(container, pattern)
-         | std::views::join
-         | std::ranges::to<result_container<Container>>();
+    if constexpr (std::is_same_v<Policy, execution::sequenced_policy>)
+    {
+        return 1;
+    }
+    else
+    {
+        if (policy.threads != 0)
+        {
+            return std::clamp<std::size_t>(policy.threads, 1,
+                std::max<std::size_t>(size, 1));
+        }
+
+        std::size_t threads = std::thread::hardware_concurrency();
+        return std::clamp<std::size_t>(size / parallel_threshold, 1,
+            std::max<std::size_t>(threads, 1));
+    }
 }
 
 /**
- *  @brief  Filter out the occurrences of any of values from the container.
+ *  @brief  Call function with each chunk index, one thread per chunk.
  *
- *  @tparam  Container  A compatible container type.
- *  @param   container  A container.
- *  @param   values     The elements to remove.
- *  @return  Filtered container as @c result_container .
+ *  The first chunk runs on the calling thread.  The first exception thrown
+ *  by any chunk is rethrown after all the threads finish.
+ *
+ *  @tparam  Function  A function type taking the chunk index.
+ *  @param   chunks    The number of chunks.
+ *  @param   function  The function to call.
  */
-template<cu_compatible Container>
-[[nodiscard]] inline constexpr auto filter_out_occ(
-    const Container &container,
-    const Container &values
-)
+template<typename Function>
+inline auto parallel_for(std::size_t chunks, const Function &function)
 {
-    auto filterer = [&](const cu::value_type<Container> &element)
+    std::vector<std::exception_ptr> exceptions(chunks);
+
+    auto run = [&](std::size_t chunk)
     {
-        return std::ranges::find(values, element) == values.end();
+        try
+        {
+            function(chunk);
+        }
+        catch (...)
+        {
+            exceptions[chunk] = std::current_exception();
+        }
     };
 
-    return std::views::filter(container, filterer)
-         | std::ranges::to<result_container<Container>>();
+    {
+        std::vector<std::jthread> threads;
+        threads.reserve(chunks - 1);
+        for (std::size_t i = 1; i < chunks; i++) threads.emplace_back(run, i);
+        run(0);
+    }
+
+    for (auto &exception : exceptions)
+    {
+        if (exception) std::rethrow_exception(exception);
+    }
 }
 
 /**
- *  @brief  Filter out the occurrences of any of sequences from the container.
+ *  @brief  Copy the elements of the concatenated sources into the output
+ *          range @c [first, last) of the result.
  *
- *  @tparam  Container        A compatible container type.
- *  @tparam  NestedContainer  A compatible container type nested container type.
- *  @param   container        A container.
- *  @param   patterns         The sequences to remove.
- *  @return  Filtered container as @c result_container .
+ *  @tparam  T        The element type.
+ *  @tparam  Output   A random access iterator type.
+ *  @param   sources  The sources, concatenated.
+ *  @param   first    The first index of the result to write.
+ *  @param   last     The end index of the result to write.
+ *  @param   output   Iterator to the beginning of the result.
  */
-template<cu_compatible Container, cu_compatible_nested NestedContainer>
-[[nodiscard]] inline constexpr auto filter_out_occ_seq(
-    const Container       &container,
-    const NestedContainer &patterns
+template<typename T, typename Output>
+inline constexpr auto copy_concatenated(
+    std::span<const std::span<const T>> sources,
+    std::size_t                         first,
+    std::size_t                         last,
+    Output                              output
 )
 {
-    result_container<Container> result = container;
-    for (auto &pattern : patterns)
+    std::size_t offset = 0;
+    for (auto source : sources)
     {
-        result = filter_out_seq(result, pattern);
+        if (first == last) return;
+        if (first < offset + source.size())
+        {
+            std::size_t begin = first - offset;
+            std::size_t count = std::min(source.size() - begin, last - first);
+            std::copy_n(source.begin() + begin, count, output + first);
+            first += count;
+        }
+        offset += source.size();
     }
-    return result;
 }
 
+} // namespace impl
+
 /**
- *  @brief  Filter out the occurrences of value from the container.
+ *  @brief  Copy containers into one container, in parallel.
  *
- *  @tparam  Container  A compatible container type.
- *  @param   container  A container.
- *  @param   value      A value to remove.
- *  @return  Filtered container as @c result_container .
+ *  @tparam  Policy       An execution policy type.
+ *  @tparam  Container    A compatible container type.
+ *  @tparam  Allocator    An allocator type, or @c std::pmr::memory_resource
+ *                        pointer type.
+ *  @param   policy       The execution policy.
+ *  @param   container_a  The first container.
+ *  @param   container_b  The second container.
+ *  @param   allocator    The allocator of the result.
+ *  @return  Combined container as @c result_container .
+ *
+ *  @see  cu::combine.
  */
-template<cu_compatible Container>
-[[nodiscard]] inline constexpr auto filter_out(
-    const Container             &container,
-    const value_type<Container> &value
+template<execution_policy Policy, cu_compatible Container,
+    typename Allocator = std::allocator<value_type<Container>>>
+[[nodiscard]] inline auto combine(
+    const Policy    &policy,
+    const Container &container_a,
+    const Container &container_b,
+    const Allocator &allocator = Allocator()
 )
 {
-    return filter_out_seq(container, result_container<Container> { value });
+    using T = value_type<Container>;
+
+    std::size_t size   = container_a.size() + container_b.size();
+    std::size_t chunks = impl::parallel_chunks(policy, size);
+
+    if constexpr (std::is_default_constructible_v<T>)
+    {
+        if (chunks > 1)
+        {
+            std::array<std::span<const T>, 2> sources = {
+                as_span(container_a), as_span(container_b)
+            };
+
+            result_container<Container, Allocator> result(
+                make_allocator<T>(allocator));
+            result.resize(size);
+            impl::parallel_for(chunks, [&](std::size_t chunk)
+            {
+                impl::copy_concatenated<T>(sources, size * chunk / chunks,
+                    size * (chunk + 1) / chunks, result.begin());
+            });
+            return result;
+        }
+    }
+
+    return combine(container_a, container_b, allocator);
 }
 
 /**
- *  @brief  Repeat container @c n times.
+ *  @brief  Repeat container @c n times, in parallel.
  *
+ *  @tparam  Policy     An execution policy type.
  *  @tparam  Container  A compatible container type.
+ *  @tparam  Number     An arithmetic type.
+ *  @tparam  Allocator  An allocator type, or @c std::pmr::memory_resource
+ *                      pointer type.
+ *  @param   policy     The execution policy.
  *  @param   container  A container.
  *  @param   n          The number of times to repeat.
+ *  @param   allocator  The allocator of the result.
  *  @return  Repeated container as @c result_container .
+ *
+ *  @see  cu::repeat.
  */
-template<cu_compatible Container>
-[[nodiscard]] inline constexpr auto repeat(
+template<execution_policy Policy, cu_compatible Container, typename Number,
+    typename Allocator = std::allocator<value_type<Container>>>
+requires(std::is_arithmetic_v<Number>)
+[[nodiscard]] inline auto repeat(
+    const Policy    &policy,
     const Container &container,
-    std::size_t      n
+    Number           n,
+    const Allocator &allocator = Allocator()
 )
 {
-    return std::views::repeat(container, n)
-         | std::views::join
-         | std::ranges::to<result_container<Container>>();
+    using T = value_type<Container>;
+
+    std::size_t size   = container.size();
+    std::size_t total  = repeat_size(size, n);
+    std::size_t chunks = impl::parallel_chunks(policy, total);
+
+    result_container<Container, Allocator> result(make_allocator<T>(allocator));
+
+    if constexpr (std::is_default_constructible_v<T>)
+    {
+        if (chunks > 1)
+        {
+            auto source = as_span(container);
+
+            result.resize(total);
+            impl::parallel_for(chunks, [&](std::size_t chunk)
+            {
+                std::size_t first = total * chunk / chunks;
+                std::size_t last  = total * (chunk + 1) / chunks;
+                while (first != last)
+                {
+                    std::size_t offset = first % size;
+                    std::size_t count  = std::min(size - offset,
+                        last - first);
+                    std::copy_n(source.begin() + offset, count,
+                        result.begin() + first);
+                    first += count;
+                }
+            });
+            return result;
+        }
+    }
+
+    repeat_into(container, n, result);
+    return result;
 }
 
 /**
- *  @brief  Repeat container @c n times.
+ *  @brief  Filter out the occurrences of any of values from the container, in
+ *          parallel.
  *
+ *  Each chunk counts its kept elements first, and the prefix sum of the
+ *  counts gives each chunk its position in the result.
+ *
+ *  @tparam  Policy     An execution policy type.
  *  @tparam  Container  A compatible container type.
+ *  @tparam  Allocator  An allocator type, or @c std::pmr::memory_resource
+ *                      pointer type.
+ *  @param   policy     The execution policy.
  *  @param   container  A container.
- *  @param   n          The number of times to repeat.
- *  @return  Repeated container as @c result_container .
+ *  @param   values     The elements to remove.
+ *  @param   allocator  The allocator of the result.
+ *  @return  Filtered container as @c result_container .
  *
- *  @see  @c std::size_t overload of @c repeat .
+ *  @see  cu::filter_out_occ.
  */
-template<cu_compatible Container>
-[[nodiscard]] inline constexpr auto repeat(
+template<execution_policy Policy, cu_compatible Container,
+    typename Allocator = std::allocator<value_type<Container>>>
+[[nodiscard]] inline auto filter_out_occ(
+    const Policy    &policy,
     const Container &container,
-    int              n
+    const Container &values,
+    const Allocator &allocator = Allocator()
 )
 {
-    // Performance-critical, don't use exceptions
-    if (n < 0) n = 0;
-    return repeat(container, (std::size_t)n);
+    using T = value_type<Container>;
+
+    auto        elements = as_span(container);
+    std::size_t chunks   = impl::parallel_chunks(policy, elements.size());
+    if constexpr (std::is_default_constructible_v<T>)
+    {
+        if (chunks > 1)
+        {
+            views::occ_matcher<T> matcher(as_span(values));
+
+            auto bound = [&](std::size_t chunk)
+            {
+                return elements.data() + elements.size() * chunk / chunks;
+            };
+
+            // Count the kept elements of each chunk
+            std::vector<std::size_t> offsets(chunks + 1);
+            impl::parallel_for(chunks, [&](std::size_t chunk)
+            {
+                const T *first = bound(chunk);
+                const T *last  = bound(chunk + 1);
+                std::size_t kept = 0;
+                while (first != last)
+                {
+                    const T *match = matcher.find(first, last).data();
+                    kept += match - first;
+                    first = match == last ? last : match + 1;
+                }
+                offsets[chunk + 1] = kept;
+            });
+            std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+            result_container<Container, Allocator> result(
+                make_allocator<T>(allocator));
+            result.resize(offsets.back());
+            impl::parallel_for(chunks, [&](std::size_t chunk)
+            {
+                const T *first  = bound(chunk);
+                const T *last   = bound(chunk + 1);
+                auto     output = result.begin() + offsets[chunk];
+                while (first != last)
+                {
+                    const T *match = matcher.find(first, last).data();
+                    output = std::copy(first, match, output);
+                    first  = match == last ? last : match + 1;
+                }
+            });
+            return result;
+        }
+    }
+
+    return filter_out_occ(container, values, allocator);
 }
 
 /**
- *  @brief  Repeat container @c n times.
+ *  @brief  Split the container with any of values, in parallel.
  *
+ *  Each chunk finds its values, and the pieces are stitched across chunk
+ *  boundaries from the positions of all the values in order.
+ *
+ *  @tparam  Policy     An execution policy type.
  *  @tparam  Container  A compatible container type.
+ *  @tparam  Allocator  An allocator type, or @c std::pmr::memory_resource
+ *                      pointer type.
+ *  @param   policy     The execution policy.
  *  @param   container  A container.
- *  @param   n          The number of times to repeat.
- *  @return  Repeated container as @c result_container .
+ *  @param   values     The values to split with.
+ *  @param   allocator  The allocator of the result.
+ *  @return  Split container as @c result_container_nested .
  *
- *  @see  @c std::size_t overload of @c repeat .
+ *  @see  cu::split_occ.
  */
-template<cu_compatible Container>
-[[nodiscard]] inline constexpr auto repeat(
+template<execution_policy Policy, cu_compatible Container,
+    typename Allocator = std::allocator<value_type<Container>>>
+[[nodiscard]] inline auto split_occ(
+    const Policy    &policy,
     const Container &container,
-    unsigned         n
+    const Container &values,
+    const Allocator &allocator = Allocator()
 )
 {
-    return repeat(container, (std::size_t)n);
+    using T     = value_type<Container>;
+    using Inner = result_container<Container, Allocator>;
+
+    auto        elements = as_span(container);
+    std::size_t chunks   = impl::parallel_chunks(policy, elements.size());
+    if constexpr (!std::is_default_constructible_v<T>)
+    {
+        // Pieces are sized on the calling thread and filled in parallel
+        return split_occ(container, values, allocator);
+    }
+    else
+    {
+        if (chunks == 1)
+        {
+            return split_occ(container, values, allocator);
+        }
+
+        views::occ_matcher<T> matcher(as_span(values));
+
+        // Find the positions of values of each chunk
+        std::vector<std::vector<std::size_t>> chunk_positions(chunks);
+        impl::parallel_for(chunks, [&](std::size_t chunk)
+        {
+            const T *first = elements.data() + elements.size() * chunk / chunks;
+            const T *last  = elements.data()
+                           + elements.size() * (chunk + 1) / chunks;
+            while (first != last)
+            {
+                const T *match = matcher.find(first, last).data();
+                if (match == last) break;
+                chunk_positions[chunk].push_back(match - elements.data());
+                first = match + 1;
+            }
+        });
+
+        std::vector<std::size_t> positions = {};
+        for (const auto &chunk : chunk_positions)
+        {
+            positions.insert(positions.end(), chunk.begin(), chunk.end());
+        }
+
+        // Container ending with one of values does not end with an empty piece
+        std::size_t pieces = positions.size() + 1;
+        if (!positions.empty() && positions.back() + 1 == elements.size())
+        {
+            pieces--;
+        }
+
+        auto piece_begin = [&](std::size_t i)
+        {
+            return i == 0 ? 0 : positions[i - 1] + 1;
+        };
+        auto piece_end = [&](std::size_t i)
+        {
+            return i < positions.size() ? positions[i] : elements.size();
+        };
+
+        // Allocate on the calling thread only, as the allocator may not be
+        // thread-safe, such as std::pmr::monotonic_buffer_resource
+        result_container_nested<Container, Allocator> result(
+            make_allocator<Inner>(allocator));
+        result.reserve(pieces);
+        for (std::size_t i = 0; i < pieces; i++)
+        {
+            result.push_back(Inner(make_allocator<T>(allocator)));
+            result.back().resize(piece_end(i) - piece_begin(i));
+        }
+
+        std::size_t piece_chunks = std::clamp<std::size_t>(pieces, 1, chunks);
+        impl::parallel_for(piece_chunks, [&](std::size_t chunk)
+        {
+            std::size_t first = pieces * chunk / piece_chunks;
+            std::size_t last  = pieces * (chunk + 1) / piece_chunks;
+            for (std::size_t i = first; i < last; i++)
+            {
+                std::copy(elements.begin() + piece_begin(i),
+                    elements.begin() + piece_end(i), result[i].begin());
+            }
+        });
+        return result;
+    }
 }
 
 /**
- *  @brief  Repeat container @c n times.
- *
+ *  @brief  Container to split into @c jagged with CU operators.
  *  @tparam  Container  A compatible container type.
- *  @param   container  A container.
- *  @param   n          The number of times to repeat.
- *  @return  Repeated container as @c result_container .
- *
- *  @see  @c std::size_t overload of @c repeat .
  */
 template<cu_compatible Container>
-[[nodiscard]] inline constexpr auto repeat(
-    const Container &container,
-    long             n
-)
-{
-    // Performance-critical, don't use exceptions
-    if (n < 0) n = 0;
-    return repeat(container, (std::size_t)n);
-}
+struct jagged_operand {
+
+    /**
+     *  @brief  The container to split.
+     */
+    const Container &container;
+};
 
 /**
- *  @brief  Repeat container @c n times.
+ *  @brief  Make CU operators split the container into @c jagged instead of
+ *          @c result_container_nested .
  *
  *  @tparam  Container  A compatible container type.
  *  @param   container  A container.
- *  @param   n          The number of times to repeat.
- *  @return  Repeated container as @c result_container .
- *
- *  @see  @c std::size_t overload of @c repeat .
+ *  @return  The container as @c jagged_operand .
  */
 template<cu_compatible Container>
-[[nodiscard]] inline constexpr auto repeat(
-    const Container &container,
-    long long        n
-)
+[[nodiscard]] inline constexpr auto as_jagged(const Container &container)
 {
-    // Performance-critical, don't use exceptions
-    if (n < 0) n = 0;
-    return repeat(container, (std::size_t)n);
+    return jagged_operand<Container> { container };
 }
 
+template<typename Result, typename Derived>
+struct expression;
+
 /**
- *  @brief  Repeat container @c n times.
+ *  @brief  Lazily evaluated expression of CU or SM operators.
+ *  @tparam  Expression  The type to check.
+ */
+template<typename Expression>
+concept cu_expression =
+    requires { typename std::remove_cvref_t<Expression>::result_type; }
+ && std::derived_from<std::remove_cvref_t<Expression>,
+        expression<typename std::remove_cvref_t<Expression>::result_type,
+            std::remove_cvref_t<Expression>>>;
+
+/**
+ *  @brief  Operand of an expression with elements of type @c T .
  *
- *  @tparam  Container  A compatible container type.
- *  @param   container  A container.
- *  @param   n          The number of times to repeat.
- *  @return  Repeated container as @c result_container .
+ *  An operand is a single value, another expression, a compatible container
+ *  or, for @c char , anything convertible to @c std::string_view .
  *
- *  @see  @c std::size_t overload of @c repeat .
+ *  @tparam  Operand  The type to check.
+ *  @tparam  T        The element type of the expression.
  */
-template<cu_compatible Container>
-[[nodiscard]] inline constexpr auto repeat(
-    const Container   &container,
-    unsigned long long n
-)
-{
-    return repeat(container, (std::size_t)n);
-}
+template<typename Operand, typename T>
+concept cu_expression_operand =
+    std::is_same_v<std::remove_cvref_t<Operand>, T>
+ || (cu_expression<Operand>
+     && std::is_same_v<typename std::remove_cvref_t<Operand>::value_type, T>)
+ || (cu_compatible<std::remove_cvref_t<Operand>>
+     && std::is_same_v<value_type<std::remove_cvref_t<Operand>>, T>)
+ || (std::is_same_v<T, char>
+     && std::is_convertible_v<const Operand &, std::string_view>);
+
+namespace impl {
 
 /**
- *  @brief  Repeat container @c n times.
+ *  @brief  A single value as an operand of an expression.
+ *  @tparam  T  The value type.
+ */
+template<typename T>
+struct single_operand {
+
+    /**
+     *  @brief  The value.
+     */
+    T value;
+};
+
+/**
+ *  @brief  How an expression stores its operand.
  *
- *  Considering integer part of the number @c n as @c i, and fraction part as
- *  @c f. The container is repeated @c i.0 times, and then the container is
- *  added with subordinate container with `round(0.f * container.size())`
- *  elements from the beginning.
+ *  Single values and expressions are stored by value, lvalues by reference
+ *  and rvalues are moved into the expression.
  *
- *  @tparam  Container  A compatible container type.
- *  @param   container  A container.
- *  @param   n          The number of times to repeat.
- *  @return  Repeated container as @c result_container .
+ *  @tparam  Operand  The operand type, as deduced by forwarding reference.
+ *  @tparam  T        The element type of the expression.
+ */
+template<typename Operand, typename T>
+using operand_storage = std::conditional_t<
+    std::is_same_v<std::remove_cvref_t<Operand>, T>,
+    single_operand<T>,
+    std::conditional_t<
+        cu_expression<Operand> || !std::is_lvalue_reference_v<Operand>,
+        std::remove_cvref_t<Operand>,
+        const std::remove_reference_t<Operand> &>>;
+
+/**
+ *  @brief  Get the number of elements of an operand.
  *
- *  @note  This is scuffed.
+ *  @tparam  T        The element type of the expression.
+ *  @tparam  Operand  The stored operand type.
+ *  @param   operand  The operand.
+ *  @return  The number of elements.
  */
-template<cu_compatible Container>
-[[nodiscard]] inline constexpr auto repeat(
-    const Container &container,
-    long double      n
-)
+template<typename T, typename Operand>
+[[nodiscard]] inline constexpr auto operand_size(const Operand &operand)
+-> std::size_t
 {
-    // Performance-critical, don't use exceptions
-    if (n < 0.0l) n = 0.0l;
+    if constexpr (std::is_same_v<Operand, single_operand<T>>)
+    {
+        return 1;
+    }
+    else if constexpr (cu_expression<Operand> || cu_compatible<Operand>)
+    {
+        return operand.size();
+    }
+    else
+    {
+        return std::string_view(operand).size();
+    }
+}
+
+/**
+ *  @brief  Write the first @c count elements of an operand.
+ *
+ *  @tparam  T        The element type of the expression.
+ *  @tparam  Operand  The stored operand type.
+ *  @tparam  Output   An output iterator type.
+ *  @param   operand  The operand.
+ *  @param   output   The output iterator to write to.
+ *  @param   count    The number of elements to write.
+ *  @return  Iterator past the last written element.
+ */
+template<typename T, typename Operand, typename Output>
+inline constexpr auto operand_write(
+    const Operand &operand,
+    Output         output,
+    std::size_t    count
+) -> Output
+{
+    if constexpr (std::is_same_v<Operand, single_operand<T>>)
+    {
+        if (count != 0) *output++ = operand.value;
+        return output;
+    }
+    else if constexpr (cu_expression<Operand>)
+    {
+        return operand.write(output, count);
+    }
+    else if constexpr (cu_compatible<Operand>)
+    {
+        return std::copy_n(operand.begin(), count, output);
+    }
+    else
+    {
+        return std::copy_n(std::string_view(operand).begin(), count, output);
+    }
+}
 
-    long double i_part         = 0.0l;
-    long double f_part         = std::modf(n, &i_part);
-    std::size_t regular_repeat = i_part;
-    std::size_t sub_size       = std::floor(f_part * container.size());
-    Container   sub = subordinate(container, 0, sub_size);
+/**
+ *  @brief  Get the allocator for the result from an operand.
+ *
+ *  @tparam  Result   The container type the expression evaluates to.
+ *  @tparam  Operand  The stored operand type.
+ *  @param   operand  The operand.
+ *  @return  Operand's allocator if compatible, default allocator otherwise.
+ */
+template<typename Result, typename Operand>
+[[nodiscard]] inline constexpr auto operand_allocator(const Operand &operand)
+-> Result::allocator_type
+{
+    using Allocator = Result::allocator_type;
 
-    return combine(repeat(container, regular_repeat), sub);
+    if constexpr (requires { operand.get_allocator(); })
+    {
+        if constexpr (std::is_constructible_v<Allocator,
+            decltype(operand.get_allocator())>)
+        {
+            return Allocator(operand.get_allocator());
+        }
+        else
+        {
+            return Allocator();
+        }
+    }
+    else
+    {
+        return Allocator();
+    }
 }
 
 /**
- *  @brief  Repeat container @c n times.
- *
- *  @tparam  Container  A compatible container type.
- *  @param   container  A container.
- *  @param   n          The number of times to repeat.
- *  @return  Repeated container as @c result_container .
+ *  @brief  Copy an operand into one allocation.
  *
- *  @note  This is scuffed.
- *  @see  `long double` overload of @c repeat .
+ *  @tparam  Result   The container type to evaluate to.
+ *  @tparam  Operand  The stored operand type.
+ *  @param   operand  The operand.
+ *  @return  Copied operand as @c Result .
  */
-template<cu_compatible Container>
-[[nodiscard]] inline constexpr auto repeat(
-    const Container &container,
-    float            n
-)
+template<typename Result, typename Operand>
+[[nodiscard]] inline constexpr auto evaluate_operand(const Operand &operand)
+-> Result
 {
-    return repeat(container, (long double)n);
+    using T = Result::value_type;
+
+    std::size_t size = operand_size<T>(operand);
+
+    Result result(operand_allocator<Result>(operand));
+    result.reserve(size);
+    operand_write<T>(operand, std::back_inserter(result), size);
+    return result;
 }
 
 /**
- *  @brief  Repeat container @c n times.
- *
- *  @tparam  Container  A compatible container type.
- *  @param   container  A container.
- *  @param   n          The number of times to repeat.
- *  @return  Repeated container as @c result_container .
+ *  @brief  Filter out the occurrences of pattern from the evaluated
+ *          expression, in place.
  *
- *  @note  This is scuffed.
- *  @see  `long double` overload of @c repeat .
+ *  @tparam  Result   The container type the expression evaluates to.
+ *  @tparam  Pattern  A value, expression, container or string type.
+ *  @param   result   The evaluated expression.
+ *  @param   pattern  A value or sequence to remove.
+ *  @return  Filtered @c result .
  */
-template<cu_compatible Container>
-[[nodiscard]] inline constexpr auto repeat(
-    const Container &container,
-    double           n
-)
+template<typename Result, typename Pattern>
+[[nodiscard]] inline constexpr auto filter_expression(
+    Result         result,
+    const Pattern &pattern
+) -> Result
 {
-    return repeat(container, (long double)n);
+    using T = Result::value_type;
+
+    if constexpr (std::is_same_v<Pattern, T>)
+    {
+        filter_out_inplace(result, pattern);
+        return result;
+    }
+    else if constexpr (cu_expression<Pattern>)
+    {
+        return filter_expression(std::move(result), pattern.evaluate());
+    }
+    else if constexpr (cu_compatible<Pattern>)
+    {
+        filter_out_seq_inplace(result, searcher<Pattern>(pattern));
+        return result;
+    }
+    else
+    {
+        return filter_expression(std::move(result),
+            std::string_view(pattern));
+    }
 }
 
 /**
- *  @brief  Split the container with pattern.
+ *  @brief  Split the evaluated expression with pattern.
  *
- *  @tparam  Container  A compatible container type.
- *  @param   container  A container.
- *  @param   pattern    A pattern to split with.
- *  @return  Split container as @c result_container_nested .
+ *  @tparam  Result   The container type the expression evaluates to.
+ *  @tparam  Pattern  A value, expression, container or string type.
+ *  @param   result   The evaluated expression.
+ *  @param   pattern  A value or sequence to split with.
+ *  @return  Split @c result as vector of @c Result .
  */
-template<cu_compatible Container>
-[[nodiscard]] inline constexpr auto split_seq(
-    const Container &container,
-    const Container &pattern
+template<typename Result, typename Pattern>
+[[nodiscard]] inline constexpr auto split_expression(
+    const Result  &result,
+    const Pattern &pattern
 )
 {
-    return std::views::split(container, pattern)
-         | std::ranges::to<result_container_nested<Container>>();
+    using T      = Result::value_type;
+    using Nested = std::vector<Result,
+        rebind_allocator_t<Result, typename Result::allocator_type>>;
+
+    if constexpr (std::is_same_v<Pattern, T>)
+    {
+        return to_nested<Nested>(views::split(result, pattern),
+            result.get_allocator());
+    }
+    else if constexpr (cu_expression<Pattern>)
+    {
+        return split_expression(result, pattern.evaluate());
+    }
+    else if constexpr (cu_compatible<Pattern>)
+    {
+        return to_nested<Nested>(
+            views::split_seq(result, searcher<Pattern>(pattern)),
+            result.get_allocator());
+    }
+    else
+    {
+        return split_expression(result, std::string_view(pattern));
+    }
 }
 
+} // namespace impl
+
+template<typename Result, typename Lhs, typename Rhs>
+struct combine_expression;
+
+template<typename Result, typename Operand>
+struct repeat_expression;
+
 /**
- *  @brief  Split the container with occurrences of value.
+ *  @brief  Base of lazily evaluated CU operator expressions.
  *
- *  @tparam  Container  A compatible container type.
- *  @param   container  A container.
- *  @param   values     The values to split with.
- *  @return  Split container as @c result_container_nested .
+ *  Expressions start at @c cu::lazy or @c sm::lazy , then @c operator+ and
+ *  @c operator* build expressions instead of copying.  The size of the whole
+ *  expression is known up front, so evaluating it writes every element into
+ *  a single allocation.  @c operator- and @c operator/ evaluate the
+ *  expression first and work on the result in place.
+ *
+ *  Lvalue operands are held by reference, so an expression must not outlive
+ *  them.  Convert it to @c Result before returning it from a function that
+ *  owns its operands.
+ *
+ *  @tparam  Result   The container type the expression evaluates to.
+ *  @tparam  Derived  The expression type.
  */
-template<cu_compatible Container>
-[[nodiscard]] inline constexpr auto split_occ(
-    const Container &container,
-    const Container &values
-)
-{
-    // Couldn't find standard library to do this heavy job, so...
-    result_container_nested<Container> result;
-    auto it = container.begin();
+template<typename Result, typename Derived>
+struct expression {
+
+    /**
+     *  @brief  The container type the expression evaluates to.
+     */
+    using result_type = Result;
+
+    /**
+     *  @brief  The element type.
+     */
+    using value_type = Result::value_type;
+
+    /**
+     *  @brief  Write all the elements.
+     *
+     *  @tparam  Output  An output iterator type.
+     *  @param   output  The output iterator to write to.
+     *  @return  Iterator past the last written element.
+     */
+    template<std::output_iterator<const value_type &> Output>
+    inline constexpr auto write(Output output) const -> Output
+    {
+        const Derived &self = static_cast<const Derived &>(*this);
+        return self.write(output, self.size());
+    }
 
-    while (it != container.end())
+    /**
+     *  @brief  Copy the expression into one allocation.
+     *  @return  Evaluated expression as @c Result .
+     */
+    [[nodiscard]] inline constexpr auto evaluate() const -> Result
     {
-        auto next_it = std::find_first_of(it, container.end(), values.begin(),
-            values.end());
-        result.emplace_back(result_container<Container>(it, next_it));
-        it = next_it;
-        if (it != container.end()) ++it;
+        return impl::evaluate_operand<Result>(
+            static_cast<const Derived &>(*this));
     }
 
-    return result;
-}
+    /**
+     *  @brief  Copy the expression into one allocation.
+     *  @return  Evaluated expression as @c Result .
+     */
+    inline constexpr operator Result () const
+    {
+        return evaluate();
+    }
+
+    /**
+     *  @brief  Append operand to the expression.
+     *
+     *  @tparam  Rhs  An operand type.
+     *  @param   lhs  The expression.
+     *  @param   rhs  A value, expression, container or string.
+     *  @return  Combined expression as @c combine_expression .
+     */
+    template<cu_expression_operand<value_type> Rhs>
+    [[nodiscard]] friend inline constexpr auto operator+ (
+        Derived lhs,
+        Rhs   &&rhs
+    )
+    {
+        return combine_expression<Result, Derived,
+            impl::operand_storage<Rhs, value_type>>(std::move(lhs),
+            std::forward<Rhs>(rhs));
+    }
+
+    /**
+     *  @brief  Prepend operand to the expression.
+     *
+     *  @tparam  Lhs  An operand type.
+     *  @param   lhs  A value, container or string.
+     *  @param   rhs  The expression.
+     *  @return  Combined expression as @c combine_expression .
+     */
+    template<cu_expression_operand<value_type> Lhs>
+    requires(!cu_expression<Lhs>)
+    [[nodiscard]] friend inline constexpr auto operator+ (
+        Lhs   &&lhs,
+        Derived rhs
+    )
+    {
+        return combine_expression<Result,
+            impl::operand_storage<Lhs, value_type>, Derived>(
+            std::forward<Lhs>(lhs), std::move(rhs));
+    }
+
+    /**
+     *  @brief  Repeat the expression @c n times.
+     *
+     *  @tparam  Number   An arithmetic type.
+     *  @param   operand  The expression.
+     *  @param   n        The number of times to repeat.
+     *  @return  Repeated expression as @c repeat_expression .
+     */
+    template<typename Number>
+    requires(std::is_arithmetic_v<Number>)
+    [[nodiscard]] friend inline constexpr auto operator* (
+        Derived operand,
+        Number  n
+    )
+    {
+        return repeat_expression<Result, Derived>(std::move(operand), n);
+    }
+
+    /**
+     *  @brief  Filter out the occurrences of pattern from the expression.
+     *
+     *  @tparam  Pattern  An operand type.
+     *  @param   operand  The expression.
+     *  @param   pattern  A value or sequence to remove.
+     *  @return  Filtered expression as @c Result .
+     */
+    template<cu_expression_operand<value_type> Pattern>
+    [[nodiscard]] friend inline constexpr auto operator- (
+        const Derived &operand,
+        const Pattern &pattern
+    ) -> Result
+    {
+        return impl::filter_expression(operand.evaluate(), pattern);
+    }
+
+    /**
+     *  @brief  Filter out the occurrences of the expression from operand.
+     *
+     *  @tparam  Operand  An operand type.
+     *  @param   operand  A container or string.
+     *  @param   pattern  The expression.
+     *  @return  Filtered operand as @c Result .
+     */
+    template<cu_expression_operand<value_type> Operand>
+    requires(!cu_expression<Operand>
+          && !std::is_same_v<Operand, value_type>)
+    [[nodiscard]] friend inline constexpr auto operator- (
+        const Operand &operand,
+        const Derived &pattern
+    ) -> Result
+    {
+        return impl::filter_expression(
+            impl::evaluate_operand<Result>(operand), pattern);
+    }
+
+    /**
+     *  @brief  Split the expression with pattern.
+     *
+     *  @tparam  Pattern  An operand type.
+     *  @param   operand  The expression.
+     *  @param   pattern  A value or sequence to split with.
+     *  @return  Split expression as vector of @c Result .
+     */
+    template<cu_expression_operand<value_type> Pattern>
+    [[nodiscard]] friend inline constexpr auto operator/ (
+        const Derived &operand,
+        const Pattern &pattern
+    )
+    {
+        return impl::split_expression(operand.evaluate(), pattern);
+    }
+
+    /**
+     *  @brief  Split operand with the expression.
+     *
+     *  @tparam  Operand  An operand type.
+     *  @param   operand  A container or string.
+     *  @param   pattern  The expression.
+     *  @return  Split operand as vector of @c Result .
+     */
+    template<cu_expression_operand<value_type> Operand>
+    requires(!cu_expression<Operand>
+          && !std::is_same_v<Operand, value_type>)
+    [[nodiscard]] friend inline constexpr auto operator/ (
+        const Operand &operand,
+        const Derived &pattern
+    )
+    {
+        return impl::split_expression(
+            impl::evaluate_operand<Result>(operand), pattern);
+    }
+};
 
 /**
- *  @brief  Split the container with occurrences of any of pattern.
+ *  @brief  Expression of two operands copied into one container.
  *
- *  @tparam  Container        A compatible container type.
- *  @tparam  NestedContainer  A compatible container type nested container type.
- *  @param   container        A container.
- *  @param   patterns         The patterns to split with.
- *  @return  Split container as @c result_container_nested .
+ *  @tparam  Result  The container type the expression evaluates to.
+ *  @tparam  Lhs     The stored type of the first operand.
+ *  @tparam  Rhs     The stored type of the second operand.
+ *
+ *  @see  cu::combine.
  */
-template<cu_compatible Container, cu_compatible_nested NestedContainer>
-[[nodiscard]] inline constexpr auto split_occ_seq(
-    const Container       &container,
-    const NestedContainer &patterns
-)
-{
-    // Again couldn't find standard library to do this heavy job, so...
-    result_container_nested<Container> result;
-    auto it = container.begin();
+template<typename Result, typename Lhs, typename Rhs>
+struct combine_expression
+    : expression<Result, combine_expression<Result, Lhs, Rhs>> {
+
+    /**
+     *  @brief  The element type.
+     */
+    using value_type = Result::value_type;
+
+    using expression<Result, combine_expression>::write;
+
+    /**
+     *  @brief  The first operand.
+     */
+    Lhs lhs;
+
+    /**
+     *  @brief  The second operand.
+     */
+    Rhs rhs;
+
+    /**
+     *  @brief  Construct the expression.
+     *
+     *  @tparam  L       The first operand type.
+     *  @tparam  R       The second operand type.
+     *  @param   first   The first operand.
+     *  @param   second  The second operand.
+     */
+    template<typename L, typename R>
+    inline constexpr combine_expression(L &&first, R &&second)
+        : lhs(std::forward<L>(first)), rhs(std::forward<R>(second))
+    {}
 
-    while (it != container.end())
+    /**
+     *  @brief  Get the number of elements.
+     *
+     *  Sizes are not cached, operands held by reference may change between
+     *  building and evaluating the expression.
+     *
+     *  @return  The number of elements.
+     */
+    [[nodiscard]] inline constexpr auto size() const -> std::size_t
     {
-        auto        next_it      = container.end();
-        std::size_t pattern_size = (std::size_t)-1;
-        for (auto &pattern : patterns)
+        return impl::operand_size<value_type>(lhs)
+             + impl::operand_size<value_type>(rhs);
+    }
+
+    /**
+     *  @brief  Get the allocator of the result, from the first operand.
+     *  @return  The allocator of the result.
+     */
+    [[nodiscard]] inline constexpr auto get_allocator() const
+    {
+        return impl::operand_allocator<Result>(lhs);
+    }
+
+    /**
+     *  @brief  Write the first @c count elements.
+     *
+     *  @tparam  Output  An output iterator type.
+     *  @param   output  The output iterator to write to.
+     *  @param   count   The number of elements to write.
+     *  @return  Iterator past the last written element.
+     */
+    template<std::output_iterator<const value_type &> Output>
+    inline constexpr auto write(Output output, std::size_t count) const
+    -> Output
+    {
+        std::size_t lhs_size = impl::operand_size<value_type>(lhs);
+
+        if (count <= lhs_size)
         {
-            // Use std::search instead of std::find_first_of to find sequence
-            auto tmp = std::search(it, container.end(), pattern.begin(),
-                pattern.end());
+            return impl::operand_write<value_type>(lhs, output, count);
+        }
 
-            if (next_it > tmp)
-            {
-                next_it      = tmp;
-                pattern_size = pattern.size();
-            }
+        output = impl::operand_write<value_type>(lhs, output, lhs_size);
+        return impl::operand_write<value_type>(rhs, output,
+            count - lhs_size);
+    }
+};
+
+/**
+ *  @brief  Expression of an operand copied @c n times.
+ *
+ *  @tparam  Result   The container type the expression evaluates to.
+ *  @tparam  Operand  The stored type of the operand.
+ *
+ *  @see  cu::repeat.
+ */
+template<typename Result, typename Operand>
+struct repeat_expression
+    : expression<Result, repeat_expression<Result, Operand>> {
+
+    /**
+     *  @brief  The element type.
+     */
+    using value_type = Result::value_type;
+
+    using expression<Result, repeat_expression>::write;
+
+    /**
+     *  @brief  The operand.
+     */
+    Operand operand;
+
+    /**
+     *  @brief  The number of whole repeats.
+     */
+    std::size_t regular_repeat;
+
+    /**
+     *  @brief  The fractional part of the number of repeats.
+     */
+    long double sub_repeat;
+
+    /**
+     *  @brief  Construct the expression.
+     *
+     *  @tparam  O         The operand type.
+     *  @tparam  Number    An arithmetic type.
+     *  @param   repeated  The operand.
+     *  @param   n         The number of times to repeat.
+     */
+    template<typename O, typename Number>
+    requires(std::is_arithmetic_v<Number>)
+    inline constexpr repeat_expression(O &&repeated, Number n)
+        : operand(std::forward<O>(repeated)),
+          regular_repeat(impl::repeat_parts(n).first),
+          sub_repeat(impl::repeat_parts(n).second)
+    {}
+
+    /**
+     *  @brief  Get the number of elements of the partial repeat.
+     *
+     *  @param   operand_size  The number of elements of the operand.
+     *  @return  The number of elements of the partial repeat.
+     */
+    [[nodiscard]] inline constexpr auto sub_size(std::size_t operand_size) const
+    -> std::size_t
+    {
+        return (std::size_t)(sub_repeat * operand_size);
+    }
+
+    /**
+     *  @brief  Get the number of elements.
+     *
+     *  Sizes are not cached, operands held by reference may change between
+     *  building and evaluating the expression.
+     *
+     *  @return  The number of elements.
+     */
+    [[nodiscard]] inline constexpr auto size() const -> std::size_t
+    {
+        std::size_t operand_size = impl::operand_size<value_type>(operand);
+        return operand_size * regular_repeat + sub_size(operand_size);
+    }
+
+    /**
+     *  @brief  Get the allocator of the result, from the operand.
+     *  @return  The allocator of the result.
+     */
+    [[nodiscard]] inline constexpr auto get_allocator() const
+    {
+        return impl::operand_allocator<Result>(operand);
+    }
+
+    /**
+     *  @brief  Write the first @c count elements.
+     *
+     *  @tparam  Output  An output iterator type.
+     *  @param   output  The output iterator to write to.
+     *  @param   count   The number of elements to write.
+     *  @return  Iterator past the last written element.
+     */
+    template<std::output_iterator<const value_type &> Output>
+    inline constexpr auto write(Output output, std::size_t count) const
+    -> Output
+    {
+        std::size_t operand_size = impl::operand_size<value_type>(operand);
+        if (operand_size == 0) return output;
+
+        for (std::size_t i = 0; i < regular_repeat && count >= operand_size;
+             i++)
+        {
+            output = impl::operand_write<value_type>(operand, output,
+                operand_size);
+            count -= operand_size;
         }
+        return impl::operand_write<value_type>(operand, output, count);
+    }
+};
+
+/**
+ *  @brief  Result of CU operators on container, with the container's
+ *          allocator.
+ *  @tparam  Container  A compatible container type.
+ */
+template<cu_compatible Container>
+using operator_result = result_container<Container,
+    decltype(allocator_of(std::declval<const Container &>()))>;
+
+/**
+ *  @brief  Expression of a single operand, the start of a lazy chain.
+ *
+ *  @tparam  Result   The container type the expression evaluates to.
+ *  @tparam  Operand  The stored type of the operand.
+ *
+ *  @see  cu::lazy.
+ */
+template<typename Result, typename Operand>
+struct operand_expression
+    : expression<Result, operand_expression<Result, Operand>> {
+
+    /**
+     *  @brief  The element type.
+     */
+    using value_type = Result::value_type;
+
+    using expression<Result, operand_expression>::write;
+
+    /**
+     *  @brief  The operand.
+     */
+    Operand operand;
+
+    /**
+     *  @brief  Construct the expression.
+     *
+     *  @tparam  O        The operand type.
+     *  @param   wrapped  The operand.
+     */
+    template<typename O>
+    inline constexpr explicit operand_expression(O &&wrapped)
+        : operand(std::forward<O>(wrapped))
+    {}
 
-        result.emplace_back(result_container<Container>(it, next_it));
-        it = next_it;
-        if (it != container.end()) it += pattern_size;
+    /**
+     *  @brief  Get the number of elements.
+     *  @return  The number of elements.
+     */
+    [[nodiscard]] inline constexpr auto size() const -> std::size_t
+    {
+        return impl::operand_size<value_type>(operand);
     }
 
-    return result;
-}
+    /**
+     *  @brief  Get the allocator of the result, from the operand.
+     *  @return  The allocator of the result.
+     */
+    [[nodiscard]] inline constexpr auto get_allocator() const
+    {
+        return impl::operand_allocator<Result>(operand);
+    }
+
+    /**
+     *  @brief  Write the first @c count elements.
+     *
+     *  @tparam  Output  An output iterator type.
+     *  @param   output  The output iterator to write to.
+     *  @param   count   The number of elements to write.
+     *  @return  Iterator past the last written element.
+     */
+    template<std::output_iterator<const value_type &> Output>
+    inline constexpr auto write(Output output, std::size_t count) const
+    -> Output
+    {
+        return impl::operand_write<value_type>(operand, output, count);
+    }
+};
 
 /**
- *  @brief  Split the container with value.
+ *  @brief  Make CU operators build an expression instead of a container.
+ *
+ *  @c + and @c * on the result are evaluated in one allocation when the
+ *  expression is converted to @c cu::operator_result , e.g.
+ *  @c cu::lazy(a) + b + cu::lazy(c) * 3 .  Lvalue operands are held by
+ *  reference.
  *
  *  @tparam  Container  A compatible container type.
  *  @param   container  A container.
- *  @param   value      A value to split with.
- *  @return  Split container as @c result_container_nested .
+ *  @return  The container as @c operand_expression .
  */
-template<cu_compatible Container>
-[[nodiscard]] inline constexpr auto split(
-    const Container             &container,
-    const value_type<Container> &value
-)
+template<typename Container>
+requires(cu_compatible<std::remove_cvref_t<Container>>)
+[[nodiscard]] inline constexpr auto lazy(Container &&container)
 {
-    return split_seq(container, result_container<Container> { value });
+    using Stored = std::remove_cvref_t<Container>;
+
+    return operand_expression<operator_result<Stored>,
+        impl::operand_storage<Container, value_type<Stored>>>(
+        std::forward<Container>(container));
 }
 
 } // namespace cu
@@ -1787,43 +10251,60 @@ namespace cu_operators {
 /**
  *  @brief  Copy containers into one container.
  *
- *  @tparam  Container    A compatible container type.
+ *  @tparam  ContainerA   A compatible container type.
+ *  @tparam  ContainerB   The same container type as @c ContainerA .
  *  @param   container_a  The first container.
  *  @param   container_b  The second container.
- *  @return  Combined container as @c result_container .
+ *  @return  Combined container as @c cu::operator_result .
  *
  *  @see  cu::combine.
  */
-template<cu::cu_compatible Container>
-requires(!std::is_same_v<Container, std::string>
+template<typename ContainerA, typename ContainerB,
+    typename Container = std::remove_cvref_t<ContainerA>>
+requires(cu::cu_compatible<Container>
+      && std::is_same_v<Container, std::remove_cvref_t<ContainerB>>
+      && !std::is_same_v<Container, std::string>
       && !std::is_same_v<Container, std::string_view>)
 [[nodiscard]] inline constexpr auto operator+ (
-    const Container &container_a,
-    const Container &container_b
-)
+    ContainerA &&container_a,
+    ContainerB &&container_b
+) -> cu::operator_result<Container>
 {
-    return cu::combine(container_a, container_b);
+    using T = cu::value_type<Container>;
+
+    return cu::combine_expression<cu::operator_result<Container>,
+        cu::impl::operand_storage<ContainerA, T>,
+        cu::impl::operand_storage<ContainerB, T>>(
+        std::forward<ContainerA>(container_a),
+        std::forward<ContainerB>(container_b)).evaluate();
 }
 
 /**
  *  @brief  Copy container and value into one container.
  *
- *  @tparam  Container  A compatible container type.
- *  @param   container  A container.
- *  @param   value      A value of container's value type.
- *  @return  Value-appended container as @c result_container .
+ *  @tparam  ContainerA   A compatible container type.
+ *  @param   container_a  A container.
+ *  @param   value        A value of container's value type.
+ *  @return  Value-appended container as @c cu::operator_result .
  *
  *  @see  cu::combine.
  */
-template<cu::cu_compatible Container>
-requires(!std::is_same_v<Container, std::string>
+template<typename ContainerA,
+    typename Container = std::remove_cvref_t<ContainerA>>
+requires(cu::cu_compatible<Container>
+      && !std::is_same_v<Container, std::string>
       && !std::is_same_v<Container, std::string_view>)
 [[nodiscard]] inline constexpr auto operator+ (
-    const Container                 &container_a,
+    ContainerA                      &&container_a,
     const cu::value_type<Container> &value
-)
+) -> cu::operator_result<Container>
 {
-    return cu::combine(container_a, value);
+    using T = cu::value_type<Container>;
+
+    return cu::combine_expression<cu::operator_result<Container>,
+        cu::impl::operand_storage<ContainerA, T>,
+        cu::impl::single_operand<T>>(std::forward<ContainerA>(container_a),
+        value).evaluate();
 }
 
 /**
@@ -1847,7 +10328,8 @@ requires(!std::is_same_v<Container, std::string>
     const Container &pattern
 )
 {
-    return cu::filter_out_seq(container, pattern);
+    return cu::filter_out_seq(container, pattern,
+        cu::allocator_of(container));
 }
 
 /**
@@ -1871,271 +10353,127 @@ requires(!std::is_same_v<Container, std::string>
     const cu::value_type<Container> &value
 )
 {
-    return cu::filter_out(container, value);
-}
-
-/**
- *  @brief  Repeat container @c n times.
- *
- *  @tparam  Container  A compatible container type.
- *  @param   container  A container.
- *  @param   n          The number of times to repeat.
- *  @return  Repeated container as @c result_container .
- *
- *  @note  Use String Manipulators' operators for @c std::string or
- *         @c std::basic_string_view .
- *
- *  @see  cu::repeat.
- */
-template<cu::cu_compatible Container>
-requires(!std::is_same_v<Container, std::string>
-      && !std::is_same_v<Container, std::string_view>)
-[[nodiscard]] inline constexpr auto operator* (
-    const Container &container,
-    int      n
-)
-{
-    return cu::repeat(container, n);
-}
-
-/**
- *  @brief  Repeat container @c n times.
- *
- *  @tparam  Container  A compatible container type.
- *  @param   container  A container.
- *  @param   n          The number of times to repeat.
- *  @return  Repeated container as @c result_container .
- *
- *  @note  Use String Manipulators' operators for @c std::string or
- *         @c std::basic_string_view .
- *
- *  @see  cu::repeat.
- */
-template<cu::cu_compatible Container>
-requires(!std::is_same_v<Container, std::string>
-      && !std::is_same_v<Container, std::string_view>)
-[[nodiscard]] inline constexpr auto operator* (
-    const Container &container,
-    unsigned      n
-)
-{
-    return cu::repeat(container, n);
-}
-
-/**
- *  @brief  Repeat container @c n times.
- *
- *  @tparam  Container  A compatible container type.
- *  @param   container  A container.
- *  @param   n          The number of times to repeat.
- *  @return  Repeated container as @c result_container .
- *
- *  @note  Use String Manipulators' operators for @c std::string or
- *         @c std::basic_string_view .
- *
- *  @see  cu::repeat.
- */
-template<cu::cu_compatible Container>
-requires(!std::is_same_v<Container, std::string>
-      && !std::is_same_v<Container, std::string_view>)
-[[nodiscard]] inline constexpr auto operator* (
-    const Container &container,
-    long      n
-)
-{
-    return cu::repeat(container, n);
-}
-
-/**
- *  @brief  Repeat container @c n times.
- *
- *  @tparam  Container  A compatible container type.
- *  @param   container  A container.
- *  @param   n          The number of times to repeat.
- *  @return  Repeated container as @c result_container .
- *
- *  @note  Use String Manipulators' operators for @c std::string or
- *         @c std::basic_string_view .
- *
- *  @see  cu::repeat.
- */
-template<cu::cu_compatible Container>
-requires(!std::is_same_v<Container, std::string>
-      && !std::is_same_v<Container, std::string_view>)
-[[nodiscard]] inline constexpr auto operator* (
-    const Container &container,
-    unsigned long      n
-)
-{
-    return cu::repeat(container, n);
-}
-
-/**
- *  @brief  Repeat container @c n times.
- *
- *  @tparam  Container  A compatible container type.
- *  @param   container  A container.
- *  @param   n          The number of times to repeat.
- *  @return  Repeated container as @c result_container .
- *
- *  @note  Use String Manipulators' operators for @c std::string or
- *         @c std::basic_string_view .
- *
- *  @see  cu::repeat.
- */
-template<cu::cu_compatible Container>
-requires(!std::is_same_v<Container, std::string>
-      && !std::is_same_v<Container, std::string_view>)
-[[nodiscard]] inline constexpr auto operator* (
-    const Container &container,
-    long long      n
-)
-{
-    return cu::repeat(container, n);
+    return cu::filter_out(container, value, cu::allocator_of(container));
 }
 
 /**
  *  @brief  Repeat container @c n times.
  *
- *  @tparam  Container  A compatible container type.
- *  @param   container  A container.
- *  @param   n          The number of times to repeat.
- *  @return  Repeated container as @c result_container .
+ *  @tparam  ContainerA  A compatible container type.
+ *  @tparam  Number      An arithmetic type.
+ *  @param   container   A container.
+ *  @param   n           The number of times to repeat.
+ *  @return  Repeated container as @c cu::operator_result .
  *
  *  @note  Use String Manipulators' operators for @c std::string or
  *         @c std::basic_string_view .
  *
  *  @see  cu::repeat.
  */
-template<cu::cu_compatible Container>
-requires(!std::is_same_v<Container, std::string>
+template<typename ContainerA, typename Number,
+    typename Container = std::remove_cvref_t<ContainerA>>
+requires(cu::cu_compatible<Container>
+      && std::is_arithmetic_v<Number>
+      && !std::is_same_v<Container, std::string>
       && !std::is_same_v<Container, std::string_view>)
 [[nodiscard]] inline constexpr auto operator* (
-    const Container &container,
-    unsigned long long      n
-)
+    ContainerA &&container,
+    Number       n
+) -> cu::operator_result<Container>
 {
-    return cu::repeat(container, n);
-}
+    using T = cu::value_type<Container>;
 
-/**
- *  @brief  Repeat container @c n times.
- *
- *  @tparam  Container  A compatible container type.
- *  @param   container  A container.
- *  @param   n          The number of times to repeat.
- *  @return  Repeated container as @c result_container .
- *
- *  @note  Use String Manipulators' operators for @c std::string or
- *         @c std::basic_string_view .
- *
- *  @see  cu::repeat.
- */
-template<cu::cu_compatible Container>
-requires(!std::is_same_v<Container, std::string>
-      && !std::is_same_v<Container, std::string_view>)
-[[nodiscard]] inline constexpr auto operator* (
-    const Container &container,
-    float      n
-)
-{
-    return cu::repeat(container, n);
+    return cu::repeat_expression<cu::operator_result<Container>,
+        cu::impl::operand_storage<ContainerA, T>>(
+        std::forward<ContainerA>(container), n).evaluate();
 }
 
 /**
- *  @brief  Repeat container @c n times.
+ *  @brief  Split the container with pattern.
  *
  *  @tparam  Container  A compatible container type.
  *  @param   container  A container.
- *  @param   n          The number of times to repeat.
- *  @return  Repeated container as @c result_container .
+ *  @param   pattern    A pattern to split with.
+ *  @return  Split container as @c result_container_nested .
  *
  *  @note  Use String Manipulators' operators for @c std::string or
  *         @c std::basic_string_view .
  *
- *  @see  cu::repeat.
+ *  @see  cu::split_seq.
  */
 template<cu::cu_compatible Container>
 requires(!std::is_same_v<Container, std::string>
       && !std::is_same_v<Container, std::string_view>)
-[[nodiscard]] inline constexpr auto operator* (
+[[nodiscard]] inline constexpr auto operator/ (
     const Container &container,
-    double      n
+    const Container &pattern
 )
 {
-    return cu::repeat(container, n);
+    return cu::split_seq(container, pattern, cu::allocator_of(container));
 }
 
 /**
- *  @brief  Repeat container @c n times.
+ *  @brief  Split the container with value.
  *
  *  @tparam  Container  A compatible container type.
  *  @param   container  A container.
- *  @param   n          The number of times to repeat.
- *  @return  Repeated container as @c result_container .
+ *  @param   value      A value to split with.
+ *  @return  Split container as @c result_container_nested .
  *
  *  @note  Use String Manipulators' operators for @c std::string or
  *         @c std::basic_string_view .
  *
- *  @see  cu::repeat.
+ *  @see  cu::split.
  */
 template<cu::cu_compatible Container>
 requires(!std::is_same_v<Container, std::string>
       && !std::is_same_v<Container, std::string_view>)
-[[nodiscard]] inline constexpr auto operator* (
-    const Container &container,
-    long double      n
+[[nodiscard]] inline constexpr auto operator/ (
+    const Container                 &container,
+    const cu::value_type<Container> &value
 )
 {
-    return cu::repeat(container, n);
+    return cu::split(container, value, cu::allocator_of(container));
 }
 
 /**
  *  @brief  Split the container with pattern.
  *
  *  @tparam  Container  A compatible container type.
- *  @param   container  A container.
+ *  @param   operand    A container from @c cu::as_jagged .
  *  @param   pattern    A pattern to split with.
- *  @return  Split container as @c result_container_nested .
- *
- *  @note  Use String Manipulators' operators for @c std::string or
- *         @c std::basic_string_view .
+ *  @return  Split container as @c cu::jagged .
  *
  *  @see  cu::split_seq.
  */
 template<cu::cu_compatible Container>
-requires(!std::is_same_v<Container, std::string>
-      && !std::is_same_v<Container, std::string_view>)
 [[nodiscard]] inline constexpr auto operator/ (
-    const Container &container,
-    const Container &pattern
+    const cu::jagged_operand<Container> &operand,
+    const Container                     &pattern
 )
 {
-    return cu::split_seq(container, pattern);
+    return cu::split_seq<cu::jagged<cu::value_type<Container>>>(
+        operand.container, pattern);
 }
 
 /**
  *  @brief  Split the container with value.
  *
  *  @tparam  Container  A compatible container type.
- *  @param   container  A container.
+ *  @param   operand    A container from @c cu::as_jagged .
  *  @param   value      A value to split with.
- *  @return  Split container as @c result_container_nested .
- *
- *  @note  Use String Manipulators' operators for @c std::string or
- *         @c std::basic_string_view .
+ *  @return  Split container as @c cu::jagged .
  *
  *  @see  cu::split.
  */
 template<cu::cu_compatible Container>
-requires(!std::is_same_v<Container, std::string>
-      && !std::is_same_v<Container, std::string_view>)
 [[nodiscard]] inline constexpr auto operator/ (
-    const Container                 &container,
-    const cu::value_type<Container> &value
+    const cu::jagged_operand<Container> &operand,
+    const cu::value_type<Container>     &value
 )
 {
-    return cu::split(container, value);
+    return cu::split<cu::jagged<cu::value_type<Container>>>(operand.container,
+        value);
 }
 
 } // namespace cu_operators
@@ -2232,4 +10570,48 @@ struct formatter<auspicious_library::cu::boundless_basic_string_view<CharT,
     }
 };
 
+
+/**
+ *  @brief  Formatter for @c cu::expression , writing the elements without
+ *          evaluating the expression.
+ *
+ *  @tparam  Expression  An expression type.
+ *  @tparam  CharT       The character type.
+ */
+template<auspicious_library::cu::cu_expression Expression, typename CharT>
+requires(std::is_same_v<typename Expression::value_type, CharT>)
+struct formatter<Expression, CharT> {
+
+    /**
+     *  @brief  Parse the format specifiers (none).
+     *
+     *  @tparam  ParseContext  A parse context type.
+     *  @param   ctx           A parse context.
+     *  @return  Iterator to begin of parse context.
+     */
+    template<typename ParseContext>
+    [[nodiscard]] inline constexpr auto parse(ParseContext &ctx)
+    {
+        // No format specifiers
+        return ctx.begin();
+    }
+
+    /**
+     *  @brief  Format the expression using parsed specifiers (none).
+     *
+     *  @tparam  FormatContext  A format context type.
+     *  @param   expression     The expression to format.
+     *  @param   ctx            A format context.
+     *  @return  Iterator to end of format context.
+     */
+    template<typename FormatContext>
+    [[nodiscard]] inline constexpr auto format(
+        const Expression &expression,
+        FormatContext    &ctx
+    ) const
+    {
+        return expression.write(ctx.out());
+    }
+};
+
 } // namespace std
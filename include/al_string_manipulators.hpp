@@ -44,9 +44,13 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <cctype>
+#include <compare>
 #include <cstddef>
 #include <iterator>
+#include <locale>
 #include <ranges>
 #include <string>
 #include <type_traits>
@@ -213,86 +217,421 @@ requires std::is_same_v<cu::value_type<Container>, char>
 
 ///  @todo  Add to_string for std::string and char for consistency.
 
+namespace impl {
+
 /**
- *  @brief  Word-wrap a string at width or before width depending on the delim.
+ *  @brief  Find the first character of string in set from pos.
  *
- *  The string is tried to be split at the width if the character at the width
- *  is one of the delimiter.  If not, the split occurs at the character before
- *  the width that is one of the delimiter.  This process is repeated until the
- *  string is less than the size of width.  If a word is longer than the
- *  specified width, the word is kept as is.  If you use force, the word will be
- *  split.
+ *  @param  set     The set of characters.
+ *  @param  string  A string.
+ *  @param  pos     The position to search from.
+ *  @return  Position of the character, or @c std::string_view::npos .
+ */
+[[nodiscard]] inline constexpr auto char_set_find(
+    const cu::byte_set &set,
+    std::string_view    string,
+    std::size_t         pos
+) -> std::size_t
+{
+    if (pos >= string.size()) return std::string_view::npos;
+
+    auto end   = string.data() + string.size();
+    auto found = set.find(string.data() + pos, end);
+    return found == end ? std::string_view::npos
+                        : (std::size_t)(found - string.data());
+}
+
+/**
+ *  @brief  Find the last character of string in set at or before pos.
  *
- *  @param  string  A string to word-wrap.
- *  @param  width   The max word-wrap width.
- *  @param  force   Whether to force the string to always be less than or equal
- *                  to the width (optional).
- *  @param  delims  The delimiters, usually whitespace (optional).
- *  @return  @c result_string_nested of word-wrapped lines.
+ *  @param  set     The set of characters.
+ *  @param  string  A string.
+ *  @param  pos     The position to search backwards from.
+ *  @return  Position of the character, or @c std::string_view::npos .
+ */
+[[nodiscard]] inline constexpr auto char_set_rfind(
+    const cu::byte_set &set,
+    std::string_view    string,
+    std::size_t         pos
+) -> std::size_t
+{
+    if (string.empty()) return std::string_view::npos;
+
+    // The end of a string usually has a few characters to skip, the table is
+    // faster than a SIMD setup for that
+    for (auto i = std::min(pos, string.size() - 1) + 1; i-- != 0;)
+    {
+        if (set.contains(string[i])) return i;
+    }
+    return std::string_view::npos;
+}
+
+} // namespace impl
+
+/**
+ *  @brief  Set of characters, such as delimiters, built once (usually at
+ *          compile time) and tested in constant time.
  *
- *  @note  word-wrapped lines can be larger than width.
+ *  Both the characters and the characters not in the set are kept as
+ *  @c cu::byte_set , so finding the first character in or not in the set
+ *  uses the SIMD scanning of @c cu::byte_set::find .
  */
-[[nodiscard]] inline constexpr auto word_wrap(
+struct char_set {
+
+    /**
+     *  @brief  The characters in the set.
+     */
+    cu::byte_set members;
+
+    /**
+     *  @brief  The characters not in the set.
+     */
+    cu::byte_set others;
+
+    /**
+     *  @brief  Construct an empty set.
+     */
+    inline constexpr char_set()
+        : char_set(std::string_view())
+    {}
+
+    /**
+     *  @brief  Construct the set from characters.
+     *  @param  characters  The characters of the set.
+     */
+    inline constexpr explicit char_set(std::string_view characters)
+        : members(characters)
+    {
+        for (int c = 0; c < 256; c++)
+        {
+            if (!members.contains((unsigned char)c))
+            {
+                others.insert((unsigned char)c);
+            }
+        }
+    }
+
+    /**
+     *  @brief  Check if the character is in the set.
+     *
+     *  @param  character  The character.
+     *  @return  True if the character is in the set.
+     */
+    [[nodiscard]] inline constexpr auto contains(char character) const
+    -> bool
+    {
+        return members.contains(character);
+    }
+
+    /**
+     *  @brief  Find the first character in the set, like
+     *          @c std::string_view::find_first_of .
+     *
+     *  @param  string  A string.
+     *  @param  pos     The position to search from (optional).
+     *  @return  Position of the character, or @c std::string_view::npos .
+     */
+    [[nodiscard]] inline constexpr auto find_first_of(
+        std::string_view string,
+        std::size_t      pos = 0
+    ) const -> std::size_t
+    {
+        return impl::char_set_find(members, string, pos);
+    }
+
+    /**
+     *  @brief  Find the first character not in the set, like
+     *          @c std::string_view::find_first_not_of .
+     *
+     *  @param  string  A string.
+     *  @param  pos     The position to search from (optional).
+     *  @return  Position of the character, or @c std::string_view::npos .
+     */
+    [[nodiscard]] inline constexpr auto find_first_not_of(
+        std::string_view string,
+        std::size_t      pos = 0
+    ) const -> std::size_t
+    {
+        return impl::char_set_find(others, string, pos);
+    }
+
+    /**
+     *  @brief  Find the last character in the set, like
+     *          @c std::string_view::find_last_of .
+     *
+     *  @param  string  A string.
+     *  @param  pos     The position to search backwards from (optional).
+     *  @return  Position of the character, or @c std::string_view::npos .
+     */
+    [[nodiscard]] inline constexpr auto find_last_of(
+        std::string_view string,
+        std::size_t      pos = std::string_view::npos
+    ) const -> std::size_t
+    {
+        return impl::char_set_rfind(members, string, pos);
+    }
+
+    /**
+     *  @brief  Find the last character not in the set, like
+     *          @c std::string_view::find_last_not_of .
+     *
+     *  @param  string  A string.
+     *  @param  pos     The position to search backwards from (optional).
+     *  @return  Position of the character, or @c std::string_view::npos .
+     */
+    [[nodiscard]] inline constexpr auto find_last_not_of(
+        std::string_view string,
+        std::size_t      pos = std::string_view::npos
+    ) const -> std::size_t
+    {
+        return impl::char_set_rfind(others, string, pos);
+    }
+
+    /**
+     *  @brief  Compare two sets.
+     *
+     *  @param  a  The first set.
+     *  @param  b  The second set.
+     *  @return  True if both have the same characters.
+     */
+    [[nodiscard]] friend inline constexpr auto operator== (
+        const char_set &a,
+        const char_set &b
+    ) -> bool
+    {
+        return a.members.bits == b.members.bits;
+    }
+};
+
+/**
+ *  @brief  Whitespace characters, the default delimiters of trimming and
+ *          word-wrapping.
+ */
+inline constexpr char_set whitespace = char_set(" \t\r\n\f\v\b");
+
+/**
+ *  @brief  Word-wrap a string at width or before width depending on the delim,
+ *          passing each line to a function.
+ *
+ *  The lines are views into the string, nothing is allocated.
+ *
+ *  @tparam  Function  A function type taking @c std::string_view .
+ *  @param   string    A string to word-wrap.
+ *  @param   width     The max word-wrap width.
+ *  @param   function  The function to pass each line to.
+ *  @param   force     Whether to force the string to always be less than or
+ *                     equal to the width (optional).
+ *  @param   delims    The delimiters (optional).
+ *
+ *  @see  sm::word_wrap.
+ */
+template<typename Function>
+inline constexpr auto word_wrap_each(
     std::string_view string,
     std::size_t      width,
-    bool             force = false,
-    std::string_view delims = " \t\r\n\f\v\b"
-)
+    Function       &&function,
+    bool             force  = false,
+    const char_set  &delims = whitespace
+) -> void
 {
-    result_string_nested lines = {};
-
     // Functions expect inclusive width, and also works as a measure to have at
     // least one as width (as a side effect)
     width++;
 
     while (string.size() > width)
     {
-        // First non-delim character before or at width
-        auto pos = string.substr(0, width).find_last_of(delims);
+        // Last delim character before or at width
+        auto pos = delims.find_last_of(string, width - 1);
+
         if (pos == std::string_view::npos)
         {
             // Split without consuming character
             if (force)
             {
-                pos       = string.substr(0, width).size() - 1;
-                auto line = string.substr(0, pos);
-                string    = string.substr(pos);
-                lines.emplace_back(std::string(line));
+                auto size = std::max(width - 1, (std::size_t)1);
+                function(string.substr(0, size));
+                string = string.substr(size);
                 continue;
             }
 
-            // If not, first non-delim character after width
-            pos = string.substr(width + 1).find_first_of(delims);
+            // If not, first delim character after width
+            pos = delims.find_first_of(string, width);
 
-            // If still not, eof reached?  Prevent overflow
-            if (pos == std::string_view::npos) pos--;
-            else pos += width + 1;
+            // If still not, the rest is the last line
+            if (pos == std::string_view::npos) break;
         }
 
-        auto line = string.substr(0, pos);
-        string    = string.substr(pos + 1);
-        lines.emplace_back(std::string(line));
+        function(string.substr(0, pos));
+        string = string.substr(pos + 1);
     }
 
     if (!string.empty())
     {
-        lines.emplace_back(std::string(string));
+        function(string);
     }
+}
+
+/**
+ *  @brief  Word-wrap a string at width or before width depending on the delim,
+ *          passing each line to a function.
+ *
+ *  @tparam  Function  A function type taking @c std::string_view .
+ *  @param   string    A string to word-wrap.
+ *  @param   width     The max word-wrap width.
+ *  @param   function  The function to pass each line to.
+ *  @param   force     Whether to force the string to always be less than or
+ *                     equal to the width.
+ *  @param   delims    The delimiters.
+ *
+ *  @see  sm::word_wrap.
+ */
+template<typename Function>
+inline constexpr auto word_wrap_each(
+    std::string_view string,
+    std::size_t      width,
+    Function       &&function,
+    bool             force,
+    std::string_view delims
+) -> void
+{
+    sm::word_wrap_each(string, width, std::forward<Function>(function), force,
+        char_set(delims));
+}
+
+/**
+ *  @brief  Word-wrap a string at width or before width depending on the delim.
+ *
+ *  The string is tried to be split at the width if the character at the width
+ *  is one of the delimiter.  If not, the split occurs at the character before
+ *  the width that is one of the delimiter.  This process is repeated until the
+ *  string is less than the size of width.  If a word is longer than the
+ *  specified width, the word is kept as is.  If you use force, the word will be
+ *  split.
+ *
+ *  @param  string  A string to word-wrap.
+ *  @param  width   The max word-wrap width.
+ *  @param  force   Whether to force the string to always be less than or equal
+ *                  to the width (optional).
+ *  @param  delims  The delimiters (optional).
+ *  @return  @c result_string_nested of word-wrapped lines.
+ *
+ *  @note  word-wrapped lines can be larger than width.
+ */
+[[nodiscard]] inline constexpr auto word_wrap(
+    std::string_view string,
+    std::size_t      width,
+    bool             force  = false,
+    const char_set  &delims = whitespace
+)
+{
+    result_string_nested lines = {};
+    sm::word_wrap_each(string, width,
+        [&](std::string_view line) { lines.emplace_back(line); }, force,
+        delims);
+    return lines;
+}
+
+/**
+ *  @brief  Word-wrap a string at width or before width depending on the delim.
+ *
+ *  @param  string  A string to word-wrap.
+ *  @param  width   The max word-wrap width.
+ *  @param  force   Whether to force the string to always be less than or equal
+ *                  to the width.
+ *  @param  delims  The delimiters.
+ *  @return  @c result_string_nested of word-wrapped lines.
+ *
+ *  @see  sm::word_wrap.
+ */
+[[nodiscard]] inline constexpr auto word_wrap(
+    std::string_view string,
+    std::size_t      width,
+    bool             force,
+    std::string_view delims
+)
+{
+    return sm::word_wrap(string, width, force, char_set(delims));
+}
 
+/**
+ *  @brief  Word-wrap a string at width or before width depending on the delim.
+ *
+ *  @param  string  A string to word-wrap, must outlive the lines.
+ *  @param  width   The max word-wrap width.
+ *  @param  force   Whether to force the string to always be less than or equal
+ *                  to the width (optional).
+ *  @param  delims  The delimiters (optional).
+ *  @return  @c std::vector of word-wrapped lines viewing into the string.
+ *
+ *  @see  sm::word_wrap.
+ */
+[[nodiscard]] inline constexpr auto word_wrap_views(
+    std::string_view string,
+    std::size_t      width,
+    bool             force  = false,
+    const char_set  &delims = whitespace
+)
+{
+    std::vector<std::string_view> lines = {};
+    sm::word_wrap_each(string, width,
+        [&](std::string_view line) { lines.emplace_back(line); }, force,
+        delims);
     return lines;
 }
 
+/**
+ *  @brief  Word-wrap a string at width or before width depending on the delim.
+ *
+ *  @param  string  A string to word-wrap, must outlive the lines.
+ *  @param  width   The max word-wrap width.
+ *  @param  force   Whether to force the string to always be less than or equal
+ *                  to the width.
+ *  @param  delims  The delimiters.
+ *  @return  @c std::vector of word-wrapped lines viewing into the string.
+ *
+ *  @see  sm::word_wrap.
+ */
+[[nodiscard]] inline constexpr auto word_wrap_views(
+    std::string_view string,
+    std::size_t      width,
+    bool             force,
+    std::string_view delims
+)
+{
+    return sm::word_wrap_views(string, width, force, char_set(delims));
+}
+
 /**
  *  @brief  Trim a string (only from left side) using delimiters (usually
  *          whitespace).
  *
  *  @param  string  A string to trim from left.
- *  @param  delims  The delimiters, usually whitespace (optional).
+ *  @param  delims  The delimiters (optional).
+ *  @return  Trimmed string.
+ */
+[[nodiscard]] inline constexpr auto trim_left(
+    std::string_view string,
+    const char_set  &delims = whitespace
+)
+{
+    auto pos = delims.find_first_not_of(string);
+    if (pos == std::string_view::npos)
+    {
+        return string;
+    }
+    return string.substr(pos);
+}
+
+/**
+ *  @brief  Trim a string (only from left side) using delimiters.
+ *
+ *  @param  string  A string to trim from left.
+ *  @param  delims  The delimiters.
  *  @return  Trimmed string.
  */
 [[nodiscard]] inline constexpr auto trim_left(
     std::string_view string,
-    std::string_view delims = " \t\r\n\f\v\b"
+    std::string_view delims
 )
 {
     auto pos = string.find_first_not_of(delims);
@@ -308,358 +647,1545 @@ requires std::is_same_v<cu::value_type<Container>, char>
  *          whitespace).
  *
  *  @param  string  A string to trim from right.
- *  @param  delims  The delimiters, usually whitespace (optional).
+ *  @param  delims  The delimiters (optional).
+ *  @return  Trimmed string.
+ */
+[[nodiscard]] inline constexpr auto trim_right(
+    std::string_view string,
+    const char_set  &delims = whitespace
+)
+{
+    auto pos = delims.find_last_not_of(string);
+    if (pos == std::string_view::npos)
+    {
+        return string;
+    }
+    return string.substr(0, pos + 1);
+}
+
+/**
+ *  @brief  Trim a string (only from right side) using delimiters.
+ *
+ *  @param  string  A string to trim from right.
+ *  @param  delims  The delimiters.
+ *  @return  Trimmed string.
+ */
+[[nodiscard]] inline constexpr auto trim_right(
+    std::string_view string,
+    std::string_view delims
+)
+{
+    auto pos = string.find_last_not_of(delims);
+    if (pos == std::string_view::npos)
+    {
+        return string;
+    }
+    return string.substr(0, pos + 1);
+}
+
+/**
+ *  @brief  Trim a string using delimiters (usually whitespace).
+ *
+ *  @param  string  A string to trim.
+ *  @param  delims  The delimiters (optional).
+ *  @return  Trimmed string.
+ */
+[[nodiscard]] inline constexpr auto trim(
+    std::string_view string,
+    const char_set  &delims = whitespace
+)
+{
+    return trim_left(trim_right(string, delims), delims);
+}
+
+/**
+ *  @brief  Trim a string using delimiters.
+ *
+ *  @param  string  A string to trim.
+ *  @param  delims  The delimiters.
  *  @return  Trimmed string.
  */
-[[nodiscard]] inline constexpr auto trim_right(
+[[nodiscard]] inline constexpr auto trim(
+    std::string_view string,
+    std::string_view delims
+)
+{
+    return trim_left(trim_right(string, delims), delims);
+}
+
+namespace impl {
+
+/**
+ *  @brief  Build a table mapping each byte to the other ASCII case if it is a
+ *          letter from @c first .
+ *
+ *  @param  first  The first letter to map, @c 'A' or @c 'a' .
+ *  @return  The table indexed by byte.
+ */
+[[nodiscard]] consteval auto ascii_case_table(char first)
+{
+    std::array<char, 256> table = {};
+    for (std::size_t i = 0; i < table.size(); i++)
+    {
+        auto c   = (char)i;
+        table[i] = c >= first && c < first + 26 ? (char)(c ^ 0x20) : c;
+    }
+    return table;
+}
+
+/**
+ *  @brief  Table mapping each byte to ASCII lowercase.
+ */
+inline constexpr auto ascii_lower_table = ascii_case_table('A');
+
+/**
+ *  @brief  Table mapping each byte to ASCII uppercase.
+ */
+inline constexpr auto ascii_upper_table = ascii_case_table('a');
+
+#ifdef AUSPICIOUS_LIBRARY_X86_64_SIMD
+
+/**
+ *  @brief  Map the ASCII letters from @c first to the other case, 16 bytes at
+ *          a time with SSE2.
+ *
+ *  @param  begin   The first character.
+ *  @param  end     The end of characters.
+ *  @param  output  The output to write to, may be @c begin .
+ *  @param  first   The first letter to map, @c 'A' or @c 'a' .
+ *  @return  The start of the remaining characters shorter than 16.
+ */
+[[nodiscard]] inline auto ascii_case_sse2(
+    const char *begin,
+    const char *end,
+    char       *output,
+    char        first
+) -> const char *
+{
+    // Letters are the only bytes below -128 + 26 after moving first to -128
+    const __m128i offset = _mm_set1_epi8((char)(first + 128));
+    const __m128i limit  = _mm_set1_epi8(-128 + 26);
+    const __m128i flip   = _mm_set1_epi8(0x20);
+
+    for (; end - begin >= 16; begin += 16, output += 16)
+    {
+        __m128i block   = _mm_loadu_si128((const __m128i *)begin);
+        __m128i letters = _mm_cmplt_epi8(_mm_sub_epi8(block, offset), limit);
+        _mm_storeu_si128((__m128i *)output,
+            _mm_xor_si128(block, _mm_and_si128(letters, flip)));
+    }
+    return begin;
+}
+
+/**
+ *  @brief  Map the ASCII letters from @c first to the other case, 32 bytes at
+ *          a time with AVX2.
+ *
+ *  @param  begin   The first character.
+ *  @param  end     The end of characters.
+ *  @param  output  The output to write to, may be @c begin .
+ *  @param  first   The first letter to map, @c 'A' or @c 'a' .
+ *  @return  The start of the remaining characters shorter than 32.
+ */
+[[gnu::target("avx2")]] [[nodiscard]] inline auto ascii_case_avx2(
+    const char *begin,
+    const char *end,
+    char       *output,
+    char        first
+) -> const char *
+{
+    const __m256i offset = _mm256_set1_epi8((char)(first + 128));
+    const __m256i limit  = _mm256_set1_epi8(-128 + 26);
+    const __m256i flip   = _mm256_set1_epi8(0x20);
+
+    for (; end - begin >= 32; begin += 32, output += 32)
+    {
+        __m256i block   = _mm256_loadu_si256((const __m256i *)begin);
+        __m256i letters = _mm256_cmpgt_epi8(limit,
+            _mm256_sub_epi8(block, offset));
+        _mm256_storeu_si256((__m256i *)output,
+            _mm256_xor_si256(block, _mm256_and_si256(letters, flip)));
+    }
+    return begin;
+}
+
+#endif
+
+/**
+ *  @brief  Map the ASCII letters from @c first to the other case.
+ *
+ *  On x86-64 with GCC or Clang, the characters are mapped 32 bytes at a time
+ *  with AVX2 if the CPU supports it, then 16 bytes at a time with SSE2, and
+ *  the rest through a table.
+ *
+ *  @param  begin   The first character.
+ *  @param  end     The end of characters.
+ *  @param  output  The output to write to, may be @c begin .
+ *  @param  first   The first letter to map, @c 'A' or @c 'a' .
+ */
+inline constexpr auto ascii_case(
+    const char *begin,
+    const char *end,
+    char       *output,
+    char        first
+) -> void
+{
+    if !consteval
+    {
+#ifdef AUSPICIOUS_LIBRARY_X86_64_SIMD
+        auto rest = begin;
+        if (cu::impl::has_avx2())
+        {
+            rest = ascii_case_avx2(rest, end, output, first);
+        }
+        rest = ascii_case_sse2(rest, end, output + (rest - begin), first);
+
+        output += rest - begin;
+        begin   = rest;
+#endif
+    }
+
+    const auto &table = first == 'A' ? ascii_lower_table : ascii_upper_table;
+    for (; begin != end; begin++, output++)
+    {
+        *output = table[(unsigned char)*begin];
+    }
+}
+
+} // namespace impl
+
+/**
+ *  @brief  Convert string to uppercase.
+ *
+ *  Only the ASCII letters are converted, regardless of the locale.
+ *
+ *  @param  string  A string to convert.
+ *  @return  Uppercase string.
+ */
+[[nodiscard]] inline constexpr auto to_upper(std::string_view string)
+{
+    std::string str(string.size(), '\0');
+    impl::ascii_case(string.data(), string.data() + string.size(), str.data(),
+        'a');
+    return str;
+}
+
+/**
+ *  @brief  Convert string to lowercase.
+ *
+ *  Only the ASCII letters are converted, regardless of the locale.
+ *
+ *  @param  string  A string to convert.
+ *  @return  Lowercase string.
+ */
+[[nodiscard]] inline constexpr auto to_lower(std::string_view string)
+{
+    std::string str(string.size(), '\0');
+    impl::ascii_case(string.data(), string.data() + string.size(), str.data(),
+        'A');
+    return str;
+}
+
+/**
+ *  @brief  Convert string to uppercase using the locale.
+ *
+ *  @param  string  A string to convert.
+ *  @param  locale  The locale to convert with.
+ *  @return  Uppercase string.
+ */
+[[nodiscard]] inline auto to_upper(
+    std::string_view   string,
+    const std::locale &locale
+)
+{
+    std::string str(string);
+    std::use_facet<std::ctype<char>>(locale).toupper(str.data(),
+        str.data() + str.size());
+    return str;
+}
+
+/**
+ *  @brief  Convert string to lowercase using the locale.
+ *
+ *  @param  string  A string to convert.
+ *  @param  locale  The locale to convert with.
+ *  @return  Lowercase string.
+ */
+[[nodiscard]] inline auto to_lower(
+    std::string_view   string,
+    const std::locale &locale
+)
+{
+    std::string str(string);
+    std::use_facet<std::ctype<char>>(locale).tolower(str.data(),
+        str.data() + str.size());
+    return str;
+}
+
+/**
+ *  @brief  Convert character to uppercase (exists for consistency).
+ *
+ *  @param  character  A character to convert.
+ *  @return  Uppercase character.
+ */
+[[nodiscard]] inline constexpr auto to_upper(char character)
+{
+    return impl::ascii_upper_table[(unsigned char)character];
+}
+
+/**
+ *  @brief  Convert character to lowercase (exists for consistency).
+ *
+ *  @param  character  A character to convert.
+ *  @return  Lowercase character.
+ */
+[[nodiscard]] inline constexpr auto to_lower(char character)
+{
+    return impl::ascii_lower_table[(unsigned char)character];
+}
+
+/**
+ *  @brief  Compare string, case insensitivity.
+ *
+ *  Only the ASCII letters are compared case insensitively, nothing is
+ *  allocated.
+ *
+ *  @param  a  The first string.
+ *  @param  b  The second string.
+ *  @return  True if they are equal, case insensitively.
+ */
+[[nodiscard]] inline constexpr auto is_equal_ins(
+    std::string_view a,
+    std::string_view b
+)
+{
+    if (a.size() != b.size()) return false;
+
+    for (std::size_t i = 0; i < a.size(); i++)
+    {
+        if (to_lower(a[i]) != to_lower(b[i])) return false;
+    }
+    return true;
+}
+
+/**
+ *  @brief  Compare character, case insensitivity (exists for consistency).
+ *
+ *  @param  a  The first character.
+ *  @param  b  The second character.
+ *  @return  True if they are equal, case insensitively.
+ */
+[[nodiscard]] inline constexpr auto is_equal_ins(char a, char b)
+{
+    // Either of them will do...
+    return to_lower(a) == to_lower(b);
+}
+
+/**
+ *  @brief  Order strings lexicographically, case insensitivity.
+ *
+ *  Characters are compared as unsigned bytes after converting ASCII letters
+ *  to lowercase, nothing is allocated.
+ *
+ *  @param  a  The first string.
+ *  @param  b  The second string.
+ *  @return  Ordering of @c a relative to @c b .
+ */
+[[nodiscard]] inline constexpr auto compare_ins(
+    std::string_view a,
+    std::string_view b
+) -> std::weak_ordering
+{
+    auto size = std::min(a.size(), b.size());
+    for (std::size_t i = 0; i < size; i++)
+    {
+        auto x = (unsigned char)to_lower(a[i]);
+        auto y = (unsigned char)to_lower(b[i]);
+        if (x != y) return x <=> y;
+    }
+    return a.size() <=> b.size();
+}
+
+/**
+ *  @brief  Hash string, case insensitivity.
+ *
+ *  Strings equal by @c is_equal_ins have equal hashes.
+ *
+ *  @param  string  A string.
+ *  @return  FNV-1a hash of the lowercase string.
+ */
+[[nodiscard]] inline constexpr auto hash_ins(std::string_view string)
+-> std::size_t
+{
+    auto lower = [](char c) { return to_lower(c); };
+    return (std::size_t)cu::impl::fnv1a(string, lower);
+}
+
+/**
+ *  @brief  Case insensitive hash, for heterogeneous lookup in unordered
+ *          containers of strings.
+ */
+struct ci_hash {
+
+    /**
+     *  @brief  Allow lookup with any type convertible to string view.
+     */
+    using is_transparent = void;
+
+    /**
+     *  @brief  Hash string, case insensitivity.
+     *
+     *  @param  string  A string.
+     *  @return  The hash.
+     */
+    [[nodiscard]] inline constexpr auto operator() (
+        std::string_view string
+    ) const -> std::size_t
+    {
+        return hash_ins(string);
+    }
+};
+
+/**
+ *  @brief  Case insensitive equality, for heterogeneous lookup in unordered
+ *          containers of strings.
+ */
+struct ci_equal {
+
+    /**
+     *  @brief  Allow lookup with any type convertible to string view.
+     */
+    using is_transparent = void;
+
+    /**
+     *  @brief  Compare string, case insensitivity.
+     *
+     *  @param  a  The first string.
+     *  @param  b  The second string.
+     *  @return  True if they are equal, case insensitively.
+     */
+    [[nodiscard]] inline constexpr auto operator() (
+        std::string_view a,
+        std::string_view b
+    ) const -> bool
+    {
+        return is_equal_ins(a, b);
+    }
+};
+
+/**
+ *  @brief  Case insensitive ordering, for heterogeneous lookup in ordered
+ *          containers of strings.
+ */
+struct ci_less {
+
+    /**
+     *  @brief  Allow lookup with any type convertible to string view.
+     */
+    using is_transparent = void;
+
+    /**
+     *  @brief  Order strings, case insensitivity.
+     *
+     *  @param  a  The first string.
+     *  @param  b  The second string.
+     *  @return  True if @c a is ordered before @c b , case insensitively.
+     */
+    [[nodiscard]] inline constexpr auto operator() (
+        std::string_view a,
+        std::string_view b
+    ) const -> bool
+    {
+        return compare_ins(a, b) < 0;
+    }
+};
+
+/**
+ *  @brief  Filter out the occurrences of sequence from the string.
+ *
+ *  @param  string   A string.
+ *  @param  pattern  A sequence to remove.
+ *  @return  Filtered string as @c std::string .
+ *
+ *  @see  cu::filter_out_seq.
+ */
+[[nodiscard]] inline constexpr auto filter_out_seq(
+    std::string_view string,
+    std::string_view pattern
+)
+{
+    std::vector<char> string_vec(string.begin(), string.end());
+    std::vector<char> values_vec(pattern.begin(), pattern.end());
+    return sm::chars_to_string(cu::filter_out_seq(string_vec, values_vec));
+}
+
+/**
+ *  @brief  Filter out the occurrences of sequence from the string.
+ *
+ *  @tparam  Pattern   A CU compatible container with character elements.
+ *  @param   string    A string.
+ *  @param   searcher  Compiled sequence to remove.
+ *  @return  Filtered string as @c std::string .
+ *
+ *  @see  cu::filter_out_seq.
+ */
+template<cu::cu_compatible Pattern>
+requires(std::is_same_v<cu::value_type<Pattern>, char>)
+[[nodiscard]] inline constexpr auto filter_out_seq(
+    std::string_view             string,
+    const cu::searcher<Pattern> &searcher
+)
+{
+    std::vector<char> string_vec(string.begin(), string.end());
+    return sm::chars_to_string(cu::filter_out_seq(string_vec, searcher));
+}
+
+/**
+ *  @brief  Filter out the occurrences of any of characters from the string.
+ *
+ *  @param  string      A string.
+ *  @param  characters  The characters to remove.
+ *  @return  Filtered string as @c std::string .
+ *
+ *  @see  cu::filter_out_occ.
+ */
+[[nodiscard]] inline constexpr auto filter_out_occ(
+    std::string_view string,
+    std::string_view characters
+)
+{
+    std::vector<char> string_vec(string.begin(), string.end());
+    std::vector<char> values_vec(characters.begin(), characters.end());
+    return sm::chars_to_string(cu::filter_out_occ(string_vec, values_vec));
+}
+
+/**
+ *  @brief  Filter out the occurrences of any of characters from the string.
+ *
+ *  @param  string      A string.
+ *  @param  characters  The set of characters to remove.
+ *  @return  Filtered string as @c std::string .
+ *
+ *  @see  cu::filter_out_occ.
+ */
+[[nodiscard]] inline constexpr auto filter_out_occ(
+    std::string_view string,
+    const char_set  &characters
+)
+{
+    std::string result = {};
+    for (auto piece : cu::views::split_occ(string, characters.members))
+    {
+        result.append(piece.begin(), piece.end());
+    }
+    return result;
+}
+
+/**
+ *  @brief  Filter out the occurrences of any of sequences from the string.
+ *
+ *  @tparam  Pattern   A CU compatible container with character elements.
+ *  @param   string    A string.
+ *  @param   searcher  Compiled sequences to remove.
+ *  @return  Filtered string as @c std::string .
+ *
+ *  @see  cu::filter_out_occ_seq.
+ */
+template<cu::cu_compatible Pattern>
+requires(std::is_same_v<cu::value_type<Pattern>, char>)
+[[nodiscard]] inline constexpr auto filter_out_occ_seq(
+    std::string_view                   string,
+    const cu::multi_searcher<Pattern> &searcher
+)
+{
+    std::vector<char> string_vec(string.begin(), string.end());
+    return sm::chars_to_string(cu::filter_out_occ_seq(string_vec, searcher));
+}
+
+/**
+ *  @brief  Filter out the occurrences of any of sequences from the string.
+ *
+ *  @tparam  Strings   A CU compatible container with string elements.
+ *  @param   string    A string.
+ *  @param   patterns  The sequences to remove.
+ *  @return  Filtered string as @c std::string .
+ *
+ *  @see  cu::filter_out_occ_seq.
+ */
+template<sm_compatible Strings>
+[[nodiscard]] inline constexpr auto filter_out_occ_seq(
+    std::string_view string,
+    const Strings   &patterns
+)
+{
+    return sm::filter_out_occ_seq(string,
+        cu::multi_searcher<cu::value_type<Strings>>(patterns));
+}
+
+/**
+ *  @brief  Filter out the occurrences of character from the string.
+ *
+ *  @param  string     A string.
+ *  @param  character  A character to remove.
+ *  @return  Filtered string as @c std::string .
+ *
+ *  @see  cu::filter_out.
+ */
+[[nodiscard]] inline constexpr auto filter_out(
+    std::string_view string,
+    char             character
+)
+{
+    std::vector<char> string_vec(string.begin(), string.end());
+    return sm::chars_to_string(cu::filter_out(string_vec, character));
+}
+
+/**
+ *  @brief  Repeat string @c n times.
+ *
+ *  @param  string  A string.
+ *  @param  n       The number of times to repeat.
+ *  @return  Repeated string as @c std::string .
+ *
+ *  @see  cu::repeat.
+ */
+[[nodiscard]] inline constexpr auto repeat(
+    std::string_view string,
+    std::size_t      n
+)
+{
+    std::vector<char> string_vec(string.begin(), string.end());
+    return sm::chars_to_string(cu::repeat(string_vec, n));
+}
+
+/**
+ *  @brief  Repeat string @c n times.
+ *
+ *  @param  string  A string.
+ *  @param  n       The number of times to repeat.
+ *  @return  Repeated string as @c std::string .
+ *
+ *  @see  cu::repeat.
+ */
+[[nodiscard]] inline constexpr auto repeat(
+    std::string_view string,
+    int      n
+)
+{
+    std::vector<char> string_vec(string.begin(), string.end());
+    return sm::chars_to_string(cu::repeat(string_vec, n));
+}
+
+/**
+ *  @brief  Repeat string @c n times.
+ *
+ *  @param  string  A string.
+ *  @param  n       The number of times to repeat.
+ *  @return  Repeated string as @c std::string .
+ *
+ *  @see  cu::repeat.
+ */
+[[nodiscard]] inline constexpr auto repeat(
+    std::string_view string,
+    unsigned      n
+)
+{
+    std::vector<char> string_vec(string.begin(), string.end());
+    return sm::chars_to_string(cu::repeat(string_vec, n));
+}
+
+/**
+ *  @brief  Repeat string @c n times.
+ *
+ *  @param  string  A string.
+ *  @param  n       The number of times to repeat.
+ *  @return  Repeated string as @c std::string .
+ *
+ *  @see  cu::repeat.
+ */
+[[nodiscard]] inline constexpr auto repeat(
+    std::string_view string,
+    long      n
+)
+{
+    std::vector<char> string_vec(string.begin(), string.end());
+    return sm::chars_to_string(cu::repeat(string_vec, n));
+}
+
+/**
+ *  @brief  Repeat string @c n times.
+ *
+ *  @param  string  A string.
+ *  @param  n       The number of times to repeat.
+ *  @return  Repeated string as @c std::string .
+ *
+ *  @see  cu::repeat.
+ */
+[[nodiscard]] inline constexpr auto repeat(
+    std::string_view string,
+    long long      n
+)
+{
+    std::vector<char> string_vec(string.begin(), string.end());
+    return sm::chars_to_string(cu::repeat(string_vec, n));
+}
+
+/**
+ *  @brief  Repeat string @c n times.
+ *
+ *  @param  string  A string.
+ *  @param  n       The number of times to repeat.
+ *  @return  Repeated string as @c std::string .
+ *
+ *  @see  cu::repeat.
+ */
+[[nodiscard]] inline constexpr auto repeat(
+    std::string_view string,
+    unsigned long long      n
+)
+{
+    std::vector<char> string_vec(string.begin(), string.end());
+    return sm::chars_to_string(cu::repeat(string_vec, n));
+}
+
+/**
+ *  @brief  Repeat string @c n times.
+ *
+ *  @param  string  A string.
+ *  @param  n       The number of times to repeat.
+ *  @return  Repeated string as @c std::string .
+ *
+ *  @see  cu::repeat.
+ */
+[[nodiscard]] inline constexpr auto repeat(
+    std::string_view string,
+    long double      n
+)
+{
+    std::vector<char> string_vec(string.begin(), string.end());
+    return sm::chars_to_string(cu::repeat(string_vec, n));
+}
+
+/**
+ *  @brief  Repeat string @c n times.
+ *
+ *  @param  string  A string.
+ *  @param  n       The number of times to repeat.
+ *  @return  Repeated string as @c std::string .
+ *
+ *  @see  cu::repeat.
+ */
+[[nodiscard]] inline constexpr auto repeat(
+    std::string_view string,
+    float      n
+)
+{
+    std::vector<char> string_vec(string.begin(), string.end());
+    return sm::chars_to_string(cu::repeat(string_vec, n));
+}
+
+/**
+ *  @brief  Repeat string @c n times.
+ *
+ *  @param  string  A string.
+ *  @param  n       The number of times to repeat.
+ *  @return  Repeated string as @c std::string .
+ *
+ *  @see  cu::repeat.
+ */
+[[nodiscard]] inline constexpr auto repeat(
+    std::string_view string,
+    double      n
+)
+{
+    std::vector<char> string_vec(string.begin(), string.end());
+    return sm::chars_to_string(cu::repeat(string_vec, n));
+}
+
+/**
+ *  @brief  Copy the string without the occurrences of sequence.
+ *
+ *  @tparam  Output   An output iterator type of characters.
+ *  @param   string   A string.
+ *  @param   pattern  A sequence to remove.
+ *  @param   output   The output iterator to write to.
+ *  @return  Iterator past the last written character.
+ *
+ *  @see  cu::filter_out_seq.
+ */
+template<std::output_iterator<const char &> Output>
+inline constexpr auto filter_out_seq_into(
+    std::string_view string,
+    std::string_view pattern,
+    Output           output
+) -> Output
+{
+    return cu::filter_out_seq_into(string, pattern, output);
+}
+
+/**
+ *  @brief  Copy the string without the occurrences of sequence.
+ *
+ *  @param  string   A string.
+ *  @param  pattern  A sequence to remove.
+ *  @param  output   The string to append to.
+ *  @return  Iterator past the last appended character.
+ *
+ *  @see  cu::filter_out_seq.
+ */
+inline constexpr auto filter_out_seq_into(
+    std::string_view string,
+    std::string_view pattern,
+    std::string     &output
+)
+{
+    sm::filter_out_seq_into(string, pattern, std::back_inserter(output));
+    return output.end();
+}
+
+/**
+ *  @brief  Copy the string without the occurrences of sequence.
+ *
+ *  @tparam  Pattern   A CU compatible container with character elements.
+ *  @tparam  Output    An output iterator type of characters.
+ *  @param   string    A string.
+ *  @param   searcher  Compiled sequence to remove.
+ *  @param   output    The output iterator to write to.
+ *  @return  Iterator past the last written character.
+ *
+ *  @see  cu::filter_out_seq.
+ */
+template<cu::cu_compatible Pattern, std::output_iterator<const char &> Output>
+requires(std::is_same_v<cu::value_type<Pattern>, char>)
+inline constexpr auto filter_out_seq_into(
+    std::string_view             string,
+    const cu::searcher<Pattern> &searcher,
+    Output                       output
+) -> Output
+{
+    return cu::filter_out_seq_into(string, searcher, output);
+}
+
+/**
+ *  @brief  Copy the string without the occurrences of sequence.
+ *
+ *  @tparam  Pattern   A CU compatible container with character elements.
+ *  @param   string    A string.
+ *  @param   searcher  Compiled sequence to remove.
+ *  @param   output    The string to append to.
+ *  @return  Iterator past the last appended character.
+ *
+ *  @see  cu::filter_out_seq.
+ */
+template<cu::cu_compatible Pattern>
+requires(std::is_same_v<cu::value_type<Pattern>, char>)
+inline constexpr auto filter_out_seq_into(
+    std::string_view             string,
+    const cu::searcher<Pattern> &searcher,
+    std::string                 &output
+)
+{
+    sm::filter_out_seq_into(string, searcher, std::back_inserter(output));
+    return output.end();
+}
+
+/**
+ *  @brief  Copy the string without the occurrences of any of characters.
+ *
+ *  @tparam  Output      An output iterator type of characters.
+ *  @param   string      A string.
+ *  @param   characters  The characters to remove.
+ *  @param   output      The output iterator to write to.
+ *  @return  Iterator past the last written character.
+ *
+ *  @see  cu::filter_out_occ.
+ */
+template<std::output_iterator<const char &> Output>
+inline constexpr auto filter_out_occ_into(
+    std::string_view string,
+    std::string_view characters,
+    Output           output
+) -> Output
+{
+    return cu::filter_out_occ_into(string, characters, output);
+}
+
+/**
+ *  @brief  Copy the string without the occurrences of any of characters.
+ *
+ *  @tparam  Output      An output iterator type of characters.
+ *  @param   string      A string.
+ *  @param   characters  The set of characters to remove.
+ *  @param   output      The output iterator to write to.
+ *  @return  Iterator past the last written character.
+ *
+ *  @see  cu::filter_out_occ.
+ */
+template<std::output_iterator<const char &> Output>
+inline constexpr auto filter_out_occ_into(
+    std::string_view string,
+    const char_set  &characters,
+    Output           output
+) -> Output
+{
+    for (auto piece : cu::views::split_occ(string, characters.members))
+    {
+        output = std::copy(piece.begin(), piece.end(), output);
+    }
+    return output;
+}
+
+/**
+ *  @brief  Copy the string without the occurrences of any of characters.
+ *
+ *  @param  string      A string.
+ *  @param  characters  The characters to remove.
+ *  @param  output      The string to append to.
+ *  @return  Iterator past the last appended character.
+ *
+ *  @see  cu::filter_out_occ.
+ */
+inline constexpr auto filter_out_occ_into(
+    std::string_view string,
+    std::string_view characters,
+    std::string     &output
+)
+{
+    sm::filter_out_occ_into(string, characters, std::back_inserter(output));
+    return output.end();
+}
+
+/**
+ *  @brief  Copy the string without the occurrences of any of characters.
+ *
+ *  @param  string      A string.
+ *  @param  characters  The set of characters to remove.
+ *  @param  output      The string to append to.
+ *  @return  Iterator past the last appended character.
+ *
+ *  @see  cu::filter_out_occ.
+ */
+inline constexpr auto filter_out_occ_into(
+    std::string_view string,
+    const char_set  &characters,
+    std::string     &output
+)
+{
+    for (auto piece : cu::views::split_occ(string, characters.members))
+    {
+        output.append(piece.begin(), piece.end());
+    }
+    return output.end();
+}
+
+/**
+ *  @brief  Copy the string without the occurrences of any of sequences.
+ *
+ *  @tparam  Strings   A CU compatible container with string elements.
+ *  @tparam  Output    An output iterator type of characters.
+ *  @param   string    A string.
+ *  @param   patterns  The sequences to remove.
+ *  @param   output    The output iterator to write to.
+ *  @return  Iterator past the last written character.
+ *
+ *  @see  cu::filter_out_occ_seq.
+ */
+template<sm_compatible Strings, std::output_iterator<const char &> Output>
+inline constexpr auto filter_out_occ_seq_into(
+    std::string_view string,
+    const Strings   &patterns,
+    Output           output
+) -> Output
+{
+    return cu::filter_out_occ_seq_into(string, patterns, output);
+}
+
+/**
+ *  @brief  Copy the string without the occurrences of any of sequences.
+ *
+ *  @tparam  Strings   A CU compatible container with string elements.
+ *  @param   string    A string.
+ *  @param   patterns  The sequences to remove.
+ *  @param   output    The string to append to.
+ *  @return  Iterator past the last appended character.
+ *
+ *  @see  cu::filter_out_occ_seq.
+ */
+template<sm_compatible Strings>
+inline constexpr auto filter_out_occ_seq_into(
+    std::string_view string,
+    const Strings   &patterns,
+    std::string     &output
+)
+{
+    sm::filter_out_occ_seq_into(string, patterns, std::back_inserter(output));
+    return output.end();
+}
+
+/**
+ *  @brief  Copy the string without the occurrences of any of sequences.
+ *
+ *  @tparam  Pattern   A CU compatible container with character elements.
+ *  @tparam  Output    An output iterator type of characters.
+ *  @param   string    A string.
+ *  @param   searcher  Compiled sequences to remove.
+ *  @param   output    The output iterator to write to.
+ *  @return  Iterator past the last written character.
+ *
+ *  @see  cu::filter_out_occ_seq.
+ */
+template<cu::cu_compatible Pattern, std::output_iterator<const char &> Output>
+requires(std::is_same_v<cu::value_type<Pattern>, char>)
+inline constexpr auto filter_out_occ_seq_into(
+    std::string_view                   string,
+    const cu::multi_searcher<Pattern> &searcher,
+    Output                             output
+) -> Output
+{
+    return cu::filter_out_occ_seq_into(string, searcher, output);
+}
+
+/**
+ *  @brief  Copy the string without the occurrences of any of sequences.
+ *
+ *  @tparam  Pattern   A CU compatible container with character elements.
+ *  @param   string    A string.
+ *  @param   searcher  Compiled sequences to remove.
+ *  @param   output    The string to append to.
+ *  @return  Iterator past the last appended character.
+ *
+ *  @see  cu::filter_out_occ_seq.
+ */
+template<cu::cu_compatible Pattern>
+requires(std::is_same_v<cu::value_type<Pattern>, char>)
+inline constexpr auto filter_out_occ_seq_into(
+    std::string_view                   string,
+    const cu::multi_searcher<Pattern> &searcher,
+    std::string                       &output
+)
+{
+    sm::filter_out_occ_seq_into(string, searcher, std::back_inserter(output));
+    return output.end();
+}
+
+/**
+ *  @brief  Copy the string without the occurrences of character.
+ *
+ *  @tparam  Output     An output iterator type of characters.
+ *  @param   string     A string.
+ *  @param   character  A character to remove.
+ *  @param   output     The output iterator to write to.
+ *  @return  Iterator past the last written character.
+ *
+ *  @see  cu::filter_out.
+ */
+template<std::output_iterator<const char &> Output>
+inline constexpr auto filter_out_into(
     std::string_view string,
-    std::string_view delims = " \t\r\n\f\v\b"
-)
+    char             character,
+    Output           output
+) -> Output
 {
-    auto pos = string.find_last_not_of(delims);
-    if (pos == std::string_view::npos)
-    {
-        return string;
-    }
-    return string.substr(0, pos + 1);
+    return cu::filter_out_into(string, character, output);
 }
 
 /**
- *  @brief  Trim a string using delimiters (usually whitespace).
+ *  @brief  Copy the string without the occurrences of character.
  *
- *  @param  string  A string to trim.
- *  @param  delims  The delimiters, usually whitespace (optional).
- *  @return  Trimmed string.
+ *  @param  string     A string.
+ *  @param  character  A character to remove.
+ *  @param  output     The string to append to.
+ *  @return  Iterator past the last appended character.
+ *
+ *  @see  cu::filter_out.
  */
-[[nodiscard]] inline constexpr auto trim(
+inline constexpr auto filter_out_into(
     std::string_view string,
-    std::string_view delims = " \t\r\n\f\v\b"
+    char             character,
+    std::string     &output
 )
 {
-    return trim_left(trim_right(string, delims), delims);
+    sm::filter_out_into(string, character, std::back_inserter(output));
+    return output.end();
 }
 
 /**
- *  @brief  Convert string to uppercase.
+ *  @brief  Copy string @c n times.
  *
- *  @param  string  A string to convert.
- *  @return  Uppercase string.
+ *  @tparam  Number  An arithmetic type.
+ *  @tparam  Output  An output iterator type of characters.
+ *  @param   string  A string.
+ *  @param   n       The number of times to repeat.
+ *  @param   output  The output iterator to write to.
+ *  @return  Iterator past the last written character.
+ *
+ *  @see  cu::repeat.
  */
-[[nodiscard]] inline constexpr auto to_upper(std::string_view string)
+template<typename Number, std::output_iterator<const char &> Output>
+requires(std::is_arithmetic_v<Number>)
+inline constexpr auto repeat_into(
+    std::string_view string,
+    Number           n,
+    Output           output
+) -> Output
 {
-    std::string str;
-    std::ranges::transform(string, std::back_inserter(str), ::toupper);
-    return str;
+    return cu::repeat_into(string, n, output);
 }
 
 /**
- *  @brief  Convert string to lowercase.
+ *  @brief  Copy string @c n times.
  *
- *  @param  string  A string to convert.
- *  @return  Lowercase string.
+ *  @tparam  Number  An arithmetic type.
+ *  @param   string  A string.
+ *  @param   n       The number of times to repeat.
+ *  @param   output  The string to append to.
+ *  @return  Iterator past the last appended character.
+ *
+ *  @see  cu::repeat.
  */
-[[nodiscard]] inline constexpr auto to_lower(std::string_view string)
+template<typename Number>
+requires(std::is_arithmetic_v<Number>)
+inline constexpr auto repeat_into(
+    std::string_view string,
+    Number           n,
+    std::string     &output
+)
 {
-    std::string str;
-    std::ranges::transform(string, std::back_inserter(str), ::tolower);
-    return str;
+    output.reserve(output.size() + cu::repeat_size(string.size(), n));
+    sm::repeat_into(string, n, std::back_inserter(output));
+    return output.end();
 }
 
 /**
- *  @brief  Convert character to uppercase (exists for consistency).
+ *  @brief  Copy string converted to uppercase.
  *
- *  @param  character  A character to convert.
- *  @return  Uppercase character.
+ *  @tparam  Output  An output iterator type of characters.
+ *  @param   string  A string to convert.
+ *  @param   output  The output iterator to write to.
+ *  @return  Iterator past the last written character.
+ *
+ *  @see  sm::to_upper.
  */
-[[nodiscard]] inline constexpr auto to_upper(char character)
+template<std::output_iterator<const char &> Output>
+inline constexpr auto to_upper_into(
+    std::string_view string,
+    Output           output
+) -> Output
 {
-    return ::toupper(character);
+    if constexpr (std::is_same_v<Output, char *>)
+    {
+        impl::ascii_case(string.data(), string.data() + string.size(), output,
+            'a');
+        return output + string.size();
+    }
+    else
+    {
+        return std::ranges::transform(string, output,
+            [](char c) { return sm::to_upper(c); }).out;
+    }
 }
 
 /**
- *  @brief  Convert character to lowercase (exists for consistency).
+ *  @brief  Copy string converted to uppercase.
  *
- *  @param  character  A character to convert.
- *  @return  Lowercase character.
+ *  @param  string  A string to convert.
+ *  @param  output  The string to append to.
+ *  @return  Iterator past the last appended character.
+ *
+ *  @see  sm::to_upper.
  */
-[[nodiscard]] inline constexpr auto to_lower(char character)
+inline constexpr auto to_upper_into(
+    std::string_view string,
+    std::string     &output
+)
 {
-    return ::tolower(character);
+    auto size = output.size();
+    output.resize(size + string.size());
+    sm::to_upper_into(string, output.data() + size);
+    return output.end();
 }
 
 /**
- *  @brief  Compare string, case insensitivity.
+ *  @brief  Copy string converted to lowercase.
  *
- *  @param  a  The first string.
- *  @param  b  The second string.
- *  @return  True if they are equal, case insensitively.
+ *  @tparam  Output  An output iterator type of characters.
+ *  @param   string  A string to convert.
+ *  @param   output  The output iterator to write to.
+ *  @return  Iterator past the last written character.
+ *
+ *  @see  sm::to_lower.
  */
-[[nodiscard]] inline constexpr auto is_equal_ins(
-    std::string_view a,
-    std::string_view b
-)
+template<std::output_iterator<const char &> Output>
+inline constexpr auto to_lower_into(
+    std::string_view string,
+    Output           output
+) -> Output
 {
-    // Either of them will do...
-    return to_lower(a) == to_lower(b);
+    if constexpr (std::is_same_v<Output, char *>)
+    {
+        impl::ascii_case(string.data(), string.data() + string.size(), output,
+            'A');
+        return output + string.size();
+    }
+    else
+    {
+        return std::ranges::transform(string, output,
+            [](char c) { return sm::to_lower(c); }).out;
+    }
 }
 
 /**
- *  @brief  Compare character, case insensitivity (exists for consistency).
+ *  @brief  Copy string converted to lowercase.
  *
- *  @param  a  The first character.
- *  @param  b  The second character.
- *  @return  True if they are equal, case insensitively.
+ *  @param  string  A string to convert.
+ *  @param  output  The string to append to.
+ *  @return  Iterator past the last appended character.
+ *
+ *  @see  sm::to_lower.
  */
-[[nodiscard]] inline constexpr auto is_equal_ins(char a, char b)
+inline constexpr auto to_lower_into(
+    std::string_view string,
+    std::string     &output
+)
 {
-    // Either of them will do...
-    return ::tolower(a) == ::tolower(b);
+    auto size = output.size();
+    output.resize(size + string.size());
+    sm::to_lower_into(string, output.data() + size);
+    return output.end();
 }
 
 /**
- *  @brief  Filter out the occurrences of sequence from the string.
+ *  @brief  Remove the occurrences of sequence from the string, in place.
  *
  *  @param  string   A string.
  *  @param  pattern  A sequence to remove.
- *  @return  Filtered string as @c std::string .
+ *  @return  The number of removed characters.
  *
  *  @see  cu::filter_out_seq.
  */
-[[nodiscard]] inline constexpr auto filter_out_seq(
-    std::string_view string,
+inline constexpr auto filter_out_seq_inplace(
+    std::string     &string,
     std::string_view pattern
-)
+) -> std::size_t
 {
-    std::vector<char> string_vec(string.begin(), string.end());
-    std::vector<char> values_vec(pattern.begin(), pattern.end());
-    return sm::chars_to_string(cu::filter_out_seq(string_vec, values_vec));
+    return cu::filter_out_seq_inplace(string,
+        cu::searcher<std::string_view>(pattern));
 }
 
 /**
- *  @brief  Filter out the occurrences of any of characters from the string.
+ *  @brief  Remove the occurrences of any of characters from the string, in
+ *          place.
  *
  *  @param  string      A string.
  *  @param  characters  The characters to remove.
- *  @return  Filtered string as @c std::string .
+ *  @return  The number of removed characters.
  *
  *  @see  cu::filter_out_occ.
  */
-[[nodiscard]] inline constexpr auto filter_out_occ(
-    std::string_view string,
+inline constexpr auto filter_out_occ_inplace(
+    std::string     &string,
     std::string_view characters
-)
+) -> std::size_t
 {
-    std::vector<char> string_vec(string.begin(), string.end());
-    std::vector<char> values_vec(characters.begin(), characters.end());
-    return sm::chars_to_string(cu::filter_out_occ(string_vec, values_vec));
+    return cu::filter_out_occ_inplace(string, characters);
 }
 
 /**
- *  @brief  Filter out the occurrences of any of sequences from the string.
+ *  @brief  Remove the occurrences of any of characters from the string, in
+ *          place.
+ *
+ *  @param  string      A string.
+ *  @param  characters  The set of characters to remove.
+ *  @return  The number of removed characters.
+ *
+ *  @see  cu::filter_out_occ.
+ */
+inline constexpr auto filter_out_occ_inplace(
+    std::string    &string,
+    const char_set &characters
+) -> std::size_t
+{
+    auto old_size = string.size();
+    auto size     = (std::size_t)0;
+
+    // Pieces are always moved back, to before where they are read from
+    for (auto piece : cu::views::split_occ(std::string_view(string),
+             characters.members))
+    {
+        if (piece.data() != string.data() + size)
+        {
+            std::copy(piece.begin(), piece.end(), string.data() + size);
+        }
+        size += piece.size();
+    }
+
+    string.resize(size);
+    return old_size - size;
+}
+
+/**
+ *  @brief  Remove the occurrences of any of sequences from the string, in
+ *          place.
  *
  *  @tparam  Strings   A CU compatible container with string elements.
  *  @param   string    A string.
  *  @param   patterns  The sequences to remove.
- *  @return  Filtered string as @c std::string .
+ *  @return  The number of removed characters.
  *
  *  @see  cu::filter_out_occ_seq.
  */
 template<sm_compatible Strings>
-[[nodiscard]] inline constexpr auto filter_out_occ_seq(
-    std::string_view string,
-    const Strings   &patterns
-)
+inline constexpr auto filter_out_occ_seq_inplace(
+    std::string   &string,
+    const Strings &patterns
+) -> std::size_t
 {
-    std::vector<char> string_vec(string.begin(), string.end());
-    std::vector<std::vector<char>> patterns_vec = {};
-    for (auto &pattern : patterns)
-    {
-        patterns_vec.emplace_back(pattern.begin(), pattern.end());
-    }
-    return sm::chars_to_string(cu::filter_out_occ_seq(string_vec,
-        patterns_vec));
+    return cu::filter_out_occ_seq_inplace(string, patterns);
 }
 
 /**
- *  @brief  Filter out the occurrences of character from the string.
+ *  @brief  Remove the occurrences of character from the string, in place.
  *
  *  @param  string     A string.
  *  @param  character  A character to remove.
- *  @return  Filtered string as @c std::string .
+ *  @return  The number of removed characters.
  *
  *  @see  cu::filter_out.
  */
-[[nodiscard]] inline constexpr auto filter_out(
-    std::string_view string,
-    char             character
-)
+inline constexpr auto filter_out_inplace(
+    std::string &string,
+    char         character
+) -> std::size_t
 {
-    std::vector<char> string_vec(string.begin(), string.end());
-    return sm::chars_to_string(cu::filter_out(string_vec, character));
+    return cu::filter_out_inplace(string, character);
 }
 
 /**
- *  @brief  Repeat string @c n times.
+ *  @brief  Repeat string @c n times, in place.
  *
- *  @param  string  A string.
- *  @param  n       The number of times to repeat.
- *  @return  Repeated string as @c std::string .
+ *  @tparam  Number  An arithmetic type.
+ *  @param   string  A string.
+ *  @param   n       The number of times to repeat.
  *
  *  @see  cu::repeat.
  */
-[[nodiscard]] inline constexpr auto repeat(
-    std::string_view string,
-    std::size_t      n
-)
+template<typename Number>
+requires(std::is_arithmetic_v<Number>)
+inline constexpr auto repeat_inplace(std::string &string, Number n)
 {
-    std::vector<char> string_vec(string.begin(), string.end());
-    return sm::chars_to_string(cu::repeat(string_vec, n));
+    cu::repeat_inplace(string, n);
 }
 
 /**
- *  @brief  Repeat string @c n times.
+ *  @brief  Convert string to uppercase, in place.
+ *  @param  string  A string.
  *
+ *  @see  sm::to_upper.
+ */
+inline constexpr auto to_upper_inplace(std::string &string)
+{
+    impl::ascii_case(string.data(), string.data() + string.size(),
+        string.data(), 'a');
+}
+
+/**
+ *  @brief  Convert string to lowercase, in place.
  *  @param  string  A string.
- *  @param  n       The number of times to repeat.
- *  @return  Repeated string as @c std::string .
  *
- *  @see  cu::repeat.
+ *  @see  sm::to_lower.
  */
-[[nodiscard]] inline constexpr auto repeat(
-    std::string_view string,
-    int      n
-)
+inline constexpr auto to_lower_inplace(std::string &string)
 {
-    std::vector<char> string_vec(string.begin(), string.end());
-    return sm::chars_to_string(cu::repeat(string_vec, n));
+    impl::ascii_case(string.data(), string.data() + string.size(),
+        string.data(), 'A');
 }
 
 /**
- *  @brief  Repeat string @c n times.
+ *  @brief  Convert string to uppercase using the locale, in place.
  *
  *  @param  string  A string.
- *  @param  n       The number of times to repeat.
- *  @return  Repeated string as @c std::string .
+ *  @param  locale  The locale to convert with.
  *
- *  @see  cu::repeat.
+ *  @see  sm::to_upper.
  */
-[[nodiscard]] inline constexpr auto repeat(
-    std::string_view string,
-    unsigned      n
-)
+inline auto to_upper_inplace(std::string &string, const std::locale &locale)
 {
-    std::vector<char> string_vec(string.begin(), string.end());
-    return sm::chars_to_string(cu::repeat(string_vec, n));
+    std::use_facet<std::ctype<char>>(locale).toupper(string.data(),
+        string.data() + string.size());
 }
 
 /**
- *  @brief  Repeat string @c n times.
+ *  @brief  Convert string to lowercase using the locale, in place.
  *
  *  @param  string  A string.
- *  @param  n       The number of times to repeat.
- *  @return  Repeated string as @c std::string .
+ *  @param  locale  The locale to convert with.
  *
- *  @see  cu::repeat.
+ *  @see  sm::to_lower.
  */
-[[nodiscard]] inline constexpr auto repeat(
+inline auto to_lower_inplace(std::string &string, const std::locale &locale)
+{
+    std::use_facet<std::ctype<char>>(locale).tolower(string.data(),
+        string.data() + string.size());
+}
+
+namespace impl {
+
+/**
+ *  @brief  Convert a piece of characters to string view.
+ *
+ *  @param  piece  A piece of characters.
+ *  @return  String view of the piece.
+ */
+[[nodiscard]] inline constexpr auto as_string_view(
+    std::span<const char> piece
+) -> std::string_view
+{
+    return std::string_view(piece.data(), piece.size());
+}
+
+} // namespace impl
+
+/**
+ *  @brief  Lazy String Manipulators, pieces are views into the string.
+ */
+namespace views {
+
+/**
+ *  @brief  Lazily split the string with pattern.
+ *
+ *  @param  string   A string, must outlive the view.
+ *  @param  pattern  A pattern to split with, must outlive the view.
+ *  @return  Range of @c std::string_view into the string.
+ *
+ *  @see  cu::views::split_seq.
+ */
+[[nodiscard]] inline constexpr auto split_seq(
     std::string_view string,
-    long      n
+    std::string_view pattern
 )
 {
-    std::vector<char> string_vec(string.begin(), string.end());
-    return sm::chars_to_string(cu::repeat(string_vec, n));
+    return cu::views::split_seq(string, pattern)
+         | std::views::transform(impl::as_string_view);
 }
 
 /**
- *  @brief  Repeat string @c n times.
+ *  @brief  Lazily split the string with pattern.
  *
- *  @param  string  A string.
- *  @param  n       The number of times to repeat.
- *  @return  Repeated string as @c std::string .
+ *  @tparam  Pattern   A CU compatible container with character elements.
+ *  @param   string    A string, must outlive the view.
+ *  @param   searcher  Compiled pattern to split with, must outlive the view.
+ *  @return  Range of @c std::string_view into the string.
  *
- *  @see  cu::repeat.
+ *  @see  cu::views::split_seq.
  */
-[[nodiscard]] inline constexpr auto repeat(
-    std::string_view string,
-    long long      n
+template<cu::cu_compatible Pattern>
+requires(std::is_same_v<cu::value_type<Pattern>, char>)
+[[nodiscard]] inline constexpr auto split_seq(
+    std::string_view             string,
+    const cu::searcher<Pattern> &searcher
 )
 {
-    std::vector<char> string_vec(string.begin(), string.end());
-    return sm::chars_to_string(cu::repeat(string_vec, n));
+    return cu::views::split_seq(string, searcher)
+         | std::views::transform(impl::as_string_view);
 }
 
 /**
- *  @brief  Repeat string @c n times.
+ *  @brief  Lazily split the string with occurrences of value.
  *
- *  @param  string  A string.
- *  @param  n       The number of times to repeat.
- *  @return  Repeated string as @c std::string .
+ *  @param  string      A string, must outlive the view.
+ *  @param  characters  The characters to split with.
+ *  @return  Range of @c std::string_view into the string.
  *
- *  @see  cu::repeat.
+ *  @see  cu::views::split_occ.
  */
-[[nodiscard]] inline constexpr auto repeat(
+[[nodiscard]] inline constexpr auto split_occ(
     std::string_view string,
-    unsigned long long      n
+    std::string_view characters
 )
 {
-    std::vector<char> string_vec(string.begin(), string.end());
-    return sm::chars_to_string(cu::repeat(string_vec, n));
+    return cu::views::split_occ(string, characters)
+         | std::views::transform(impl::as_string_view);
 }
 
 /**
- *  @brief  Repeat string @c n times.
+ *  @brief  Lazily split the string with occurrences of any of characters.
  *
- *  @param  string  A string.
- *  @param  n       The number of times to repeat.
- *  @return  Repeated string as @c std::string .
+ *  @param  string      A string, must outlive the view.
+ *  @param  characters  The set of characters to split with.
+ *  @return  Range of @c std::string_view into the string.
  *
- *  @see  cu::repeat.
+ *  @see  cu::views::split_occ.
  */
-[[nodiscard]] inline constexpr auto repeat(
+[[nodiscard]] inline constexpr auto split_occ(
     std::string_view string,
-    long double      n
+    const char_set  &characters
 )
 {
-    std::vector<char> string_vec(string.begin(), string.end());
-    return sm::chars_to_string(cu::repeat(string_vec, n));
+    return cu::views::split_occ(string, characters.members)
+         | std::views::transform(impl::as_string_view);
 }
 
 /**
- *  @brief  Repeat string @c n times.
+ *  @brief  Lazily split the string with occurrences of any of pattern.
  *
- *  @param  string  A string.
- *  @param  n       The number of times to repeat.
- *  @return  Repeated string as @c std::string .
+ *  @tparam  Pattern   A CU compatible container with character elements.
+ *  @param   string    A string, must outlive the view.
+ *  @param   searcher  Compiled patterns to split with, must outlive the view.
+ *  @return  Range of @c std::string_view into the string.
  *
- *  @see  cu::repeat.
+ *  @see  cu::views::split_occ_seq.
  */
-[[nodiscard]] inline constexpr auto repeat(
+template<cu::cu_compatible Pattern>
+requires(std::is_same_v<cu::value_type<Pattern>, char>)
+[[nodiscard]] inline constexpr auto split_occ_seq(
+    std::string_view                   string,
+    const cu::multi_searcher<Pattern> &searcher
+)
+{
+    return cu::views::split_occ_seq(string, searcher)
+         | std::views::transform(impl::as_string_view);
+}
+
+/**
+ *  @brief  Lazily split the string with occurrences of any of pattern.
+ *
+ *  @tparam  Strings   A CU compatible string with string elements.
+ *  @param   string    A string, must outlive the view.
+ *  @param   patterns  The patterns to split with.
+ *  @return  Range of @c std::string_view into the string.
+ *
+ *  @see  cu::views::split_occ_seq.
+ */
+template<sm_compatible Strings>
+[[nodiscard]] inline constexpr auto split_occ_seq(
     std::string_view string,
-    float      n
+    const Strings   &patterns
 )
 {
-    std::vector<char> string_vec(string.begin(), string.end());
-    return sm::chars_to_string(cu::repeat(string_vec, n));
+    return cu::views::split_occ_seq(string, patterns)
+         | std::views::transform(impl::as_string_view);
 }
 
 /**
- *  @brief  Repeat string @c n times.
+ *  @brief  Lazily split the string with value.
  *
- *  @param  string  A string.
- *  @param  n       The number of times to repeat.
- *  @return  Repeated string as @c std::string .
+ *  @param  string     A string, must outlive the view.
+ *  @param  character  A character to split with.
+ *  @return  Range of @c std::string_view into the string.
  *
- *  @see  cu::repeat.
+ *  @see  cu::views::split.
  */
-[[nodiscard]] inline constexpr auto repeat(
+[[nodiscard]] inline constexpr auto split(
     std::string_view string,
-    double      n
+    char             character
 )
 {
-    std::vector<char> string_vec(string.begin(), string.end());
-    return sm::chars_to_string(cu::repeat(string_vec, n));
+    return cu::views::split(string, character)
+         | std::views::transform(impl::as_string_view);
 }
 
+} // namespace views
+
 /**
  *  @brief  Split the string with pattern.
  *
@@ -674,10 +2200,27 @@ template<sm_compatible Strings>
     std::string_view pattern
 )
 {
-    std::vector<char> string_vec(string.begin(), string.end());
-    std::vector<char> pattern_vec(pattern.begin(), pattern.end());
-    auto result = cu::split_seq(string_vec, pattern_vec);
-    return std::views::transform(result, sm::chars_to_string<std::vector<char>>)
+    return sm::split_seq(string, cu::searcher<std::string_view>(pattern));
+}
+
+/**
+ *  @brief  Split the string with pattern.
+ *
+ *  @tparam  Pattern   A CU compatible container with character elements.
+ *  @param   string    A string.
+ *  @param   searcher  Compiled pattern to split with.
+ *  @return  Split string as @c result_string_nested .
+ *
+ *  @see  cu::split_seq.
+ */
+template<cu::cu_compatible Pattern>
+requires(std::is_same_v<cu::value_type<Pattern>, char>)
+[[nodiscard]] inline constexpr auto split_seq(
+    std::string_view             string,
+    const cu::searcher<Pattern> &searcher
+)
+{
+    return sm::views::split_seq(string, searcher)
          | std::ranges::to<result_string_nested>();
 }
 
@@ -695,10 +2238,46 @@ template<sm_compatible Strings>
     std::string_view characters
 )
 {
-    std::vector<char> string_vec(string.begin(), string.end());
-    std::vector<char> pattern_vec(characters.begin(), characters.end());
-    auto result = cu::split_occ(string_vec, pattern_vec);
-    return std::views::transform(result, sm::chars_to_string<std::vector<char>>)
+    return sm::views::split_occ(string, characters)
+         | std::ranges::to<result_string_nested>();
+}
+
+/**
+ *  @brief  Split the string with occurrences of any of characters.
+ *
+ *  @param  string      A string.
+ *  @param  characters  The set of characters to split with.
+ *  @return  Split string as @c result_string_nested .
+ *
+ *  @see  cu::split_occ.
+ */
+[[nodiscard]] inline constexpr auto split_occ(
+    std::string_view string,
+    const char_set  &characters
+)
+{
+    return sm::views::split_occ(string, characters)
+         | std::ranges::to<result_string_nested>();
+}
+
+/**
+ *  @brief  Split the string with occurrences of any of pattern.
+ *
+ *  @tparam  Pattern   A CU compatible container with character elements.
+ *  @param   string    A string.
+ *  @param   searcher  Compiled patterns to split with.
+ *  @return  Split string as @c result_string_nested .
+ *
+ *  @see  cu::split_occ_seq.
+ */
+template<cu::cu_compatible Pattern>
+requires(std::is_same_v<cu::value_type<Pattern>, char>)
+[[nodiscard]] inline constexpr auto split_occ_seq(
+    std::string_view                   string,
+    const cu::multi_searcher<Pattern> &searcher
+)
+{
+    return sm::views::split_occ_seq(string, searcher)
          | std::ranges::to<result_string_nested>();
 }
 
@@ -718,15 +2297,8 @@ template<sm_compatible Strings>
     const Strings   &patterns
 )
 {
-    std::vector<char> string_vec(string.begin(), string.end());
-    std::vector<std::vector<char>> patterns_vec = {};
-    for (auto &pattern : patterns)
-    {
-        patterns_vec.emplace_back(pattern.begin(), pattern.end());
-    }
-    auto result = cu::split_occ_seq(string_vec, patterns_vec);
-    return std::views::transform(result, sm::chars_to_string<std::vector<char>>)
-         | std::ranges::to<result_string_nested>();
+    return sm::split_occ_seq(string,
+        cu::multi_searcher<cu::value_type<Strings>>(patterns));
 }
 
 /**
@@ -743,204 +2315,461 @@ template<sm_compatible Strings>
     char             character
 )
 {
-    std::vector<char> string_vec(string.begin(), string.end());
-    auto result = cu::split(string_vec, character);
-    return std::views::transform(result, sm::chars_to_string<std::vector<char>>)
+    return sm::views::split(string, character)
          | std::ranges::to<result_string_nested>();
 }
 
-} // namespace sm
+/**
+ *  @brief  Incremental string splitter fed with successive chunks of a
+ *          stream.
+ *
+ *  @tparam  Matcher  The matcher type, such as @c cu::views::seq_matcher .
+ *
+ *  @see  cu::stream_splitter.
+ */
+template<typename Matcher>
+struct stream_splitter {
+
+    /**
+     *  @brief  The splitter of characters.
+     */
+    cu::stream_splitter<char, Matcher> splitter;
+
+    /**
+     *  @brief  Feed the next chunk of the stream.
+     *
+     *  @tparam  Function  A function type taking @c std::string_view .
+     *  @param   chunk     The next chunk.
+     *  @param   function  The function to pass the complete pieces to.
+     */
+    template<typename Function>
+    inline constexpr auto feed(
+        std::string_view chunk,
+        Function       &&function
+    ) -> void
+    {
+        splitter.feed(chunk, [&](std::span<const char> piece)
+        {
+            function(std::string_view(piece.begin(), piece.end()));
+        });
+    }
+
+    /**
+     *  @brief  End the stream, pass the remaining pieces to the function and
+     *          reset the splitter for another stream.
+     *
+     *  @tparam  Function  A function type taking @c std::string_view .
+     *  @param   function  The function to pass the remaining pieces to.
+     */
+    template<typename Function>
+    inline constexpr auto finish(Function &&function) -> void
+    {
+        splitter.finish([&](std::span<const char> piece)
+        {
+            function(std::string_view(piece.begin(), piece.end()));
+        });
+    }
+};
 
 /**
- *  @brief  String Manipulators, operators version.
+ *  @brief  Create a stream splitter splitting with pattern.
+ *
+ *  @param  pattern  A pattern to split with, copied into the splitter.
+ *  @return  Splitter as @c stream_splitter .
+ *
+ *  @see  cu::stream_split_seq.
  */
-namespace sm_operators {
+[[nodiscard]] inline constexpr auto stream_split_seq(std::string_view pattern)
+{
+    using Matcher = cu::searcher<std::vector<char>>;
+    return stream_splitter<Matcher> { cu::stream_split_seq(pattern) };
+}
 
 /**
- *  @brief  Filter out the occurrences of sequence from the string.
+ *  @brief  Create a stream splitter splitting with occurrences of value.
  *
- *  @param  string   A string.
- *  @param  pattern  A sequence to remove.
- *  @return  Filtered string as @c std::string .
+ *  @param  characters  The characters to split with.
+ *  @return  Splitter as @c stream_splitter .
  *
- *  @see  sm::filter_out_seq.
+ *  @see  cu::stream_split_occ.
  */
-[[nodiscard]] inline constexpr auto operator- (
-    std::string_view string,
-    std::string_view pattern
+[[nodiscard]] inline constexpr auto stream_split_occ(
+    std::string_view characters
 )
 {
-    return sm::filter_out_seq(string, pattern);
+    using Matcher = cu::views::occ_matcher<char>;
+    return stream_splitter<Matcher> { cu::stream_split_occ(characters) };
 }
 
 /**
- *  @brief  Filter out the occurrences of character from the string.
+ *  @brief  Create a stream splitter splitting with occurrences of any of
+ *          pattern.
  *
- *  @param  string     A string.
- *  @param  character  A character to remove.
- *  @return  Filtered string as @c std::string .
+ *  @tparam  Strings   A CU compatible string with string elements.
+ *  @param   patterns  The patterns to split with.
+ *  @return  Splitter as @c stream_splitter .
  *
- *  @see  sm::filter_out.
+ *  @see  cu::stream_split_occ_seq.
  */
-[[nodiscard]] inline constexpr auto operator- (
-    std::string_view string,
-    char             character
+template<sm_compatible Strings>
+[[nodiscard]] inline constexpr auto stream_split_occ_seq(
+    const Strings &patterns
 )
 {
-    return sm::filter_out(string, character);
+    using Matcher = cu::multi_searcher<cu::value_type<Strings>>;
+    return stream_splitter<Matcher> { cu::stream_split_occ_seq(patterns) };
 }
 
 /**
- *  @brief  Repeat string @c n times.
+ *  @brief  Create a stream splitter splitting with value.
  *
- *  @param  string  A string.
- *  @param  n       The number of times to repeat.
- *  @return  Repeated string as @c std::string .
+ *  @param  character  A character to split with.
+ *  @return  Splitter as @c stream_splitter .
  *
- *  @see  sm::repeat.
+ *  @see  cu::stream_split.
  */
-[[nodiscard]] inline constexpr auto operator* (
-    std::string_view string,
-    std::size_t      n
-)
+[[nodiscard]] inline constexpr auto stream_split(char character)
 {
-    return sm::repeat(string, n);
+    using Matcher = cu::views::value_matcher<char>;
+    return stream_splitter<Matcher> { cu::stream_split(character) };
 }
 
 /**
- *  @brief  Repeat string @c n times.
+ *  @brief  String of fixed size usable as a template parameter, to split,
+ *          filter and repeat string literals at compile time.
  *
- *  @param  string  A string.
- *  @param  n       The number of times to repeat.
- *  @return  Repeated string as @c std::string .
+ *  @tparam  N  The size of the string including the null terminator.
+ */
+template<std::size_t N>
+struct fixed_string {
+
+    /**
+     *  @brief  Characters of the string, null terminated.
+     */
+    std::array<char, N> characters = {};
+
+    /**
+     *  @brief  Creates a string of null characters.
+     */
+    inline constexpr fixed_string() = default;
+
+    /**
+     *  @brief  Creates a string from string literal.
+     *  @param  string  A string literal.
+     */
+    inline constexpr fixed_string(const char (&string)[N])
+    {
+        std::copy_n(string, N, characters.begin());
+    }
+
+    /**
+     *  @brief  Get the size of the string.
+     *  @return  The number of characters without the null terminator.
+     */
+    [[nodiscard]] static inline constexpr auto size() -> std::size_t
+    {
+        return N - 1;
+    }
+
+    /**
+     *  @brief  Get the string as @c std::string_view .
+     *  @return  View of the characters without the null terminator.
+     */
+    [[nodiscard]] inline constexpr auto view() const -> std::string_view
+    {
+        return std::string_view(characters.data(), size());
+    }
+
+    /**
+     *  @brief  Get the string as @c std::string_view .
+     *  @return  View of the characters without the null terminator.
+     */
+    inline constexpr operator std::string_view () const
+    {
+        return view();
+    }
+
+    /**
+     *  @brief  Compare two strings.
+     *
+     *  @param  a  The first string.
+     *  @param  b  The second string.
+     *  @return  True if all the characters are equal.
+     */
+    [[nodiscard]] friend inline constexpr auto operator== (
+        const fixed_string &a,
+        const fixed_string &b
+    ) -> bool = default;
+};
+
+/**
+ *  @brief  String Manipulators' implementation details.
+ */
+namespace impl {
+
+/**
+ *  @brief  Copy the pieces into an array of views.
  *
- *  @see  sm::repeat.
+ *  @tparam  Count   The number of pieces.
+ *  @tparam  Pieces  A range type of pieces.
+ *  @param   pieces  The pieces to copy.
+ *  @return  Array of the pieces as @c std::string_view .
  */
-[[nodiscard]] inline constexpr auto operator* (
-    std::string_view string,
-    int      n
-)
+template<std::size_t Count, typename Pieces>
+[[nodiscard]] consteval auto to_views(Pieces &&pieces)
 {
-    return sm::repeat(string, n);
+    std::array<std::string_view, Count> result = {};
+
+    std::size_t i = 0;
+    for (auto piece : pieces)
+    {
+        result[i++] = std::string_view(piece.begin(), piece.end());
+    }
+    return result;
 }
 
 /**
- *  @brief  Repeat string @c n times.
+ *  @brief  Join the pieces into a fixed string.
  *
- *  @param  string  A string.
- *  @param  n       The number of times to repeat.
- *  @return  Repeated string as @c std::string .
+ *  @tparam  Size    The total size of the pieces.
+ *  @tparam  Pieces  A range type of pieces.
+ *  @param   pieces  The pieces to join.
+ *  @return  The joined pieces as @c fixed_string .
+ */
+template<std::size_t Size, typename Pieces>
+[[nodiscard]] consteval auto to_fixed(Pieces &&pieces)
+{
+    fixed_string<Size + 1> result = {};
+
+    auto output = result.characters.begin();
+    for (auto piece : pieces)
+    {
+        output = std::copy(piece.begin(), piece.end(), output);
+    }
+    return result;
+}
+
+} // namespace impl
+
+/**
+ *  @brief  Split the string literal with pattern at compile time.
  *
- *  @see  sm::repeat.
+ *  @tparam  String   A string literal.
+ *  @tparam  Pattern  A pattern to split with.
+ *  @return  Array of the pieces as @c std::string_view , viewing @c String .
+ *
+ *  @see  sm::split_seq.
  */
-[[nodiscard]] inline constexpr auto operator* (
-    std::string_view string,
-    unsigned      n
-)
+template<fixed_string String, fixed_string Pattern>
+[[nodiscard]] consteval auto split_seq()
 {
-    return sm::repeat(string, n);
+    constexpr std::string_view string  = String;
+    constexpr std::string_view pattern = Pattern;
+    constexpr std::size_t      count   = cu::count_split_seq(string, pattern);
+    return impl::to_views<count>(cu::views::split_seq(string, pattern));
 }
 
 /**
- *  @brief  Repeat string @c n times.
+ *  @brief  Split the string literal with occurrences of value at compile
+ *          time.
  *
- *  @param  string  A string.
- *  @param  n       The number of times to repeat.
- *  @return  Repeated string as @c std::string .
+ *  @tparam  String      A string literal.
+ *  @tparam  Characters  The characters to split with.
+ *  @return  Array of the pieces as @c std::string_view , viewing @c String .
  *
- *  @see  sm::repeat.
+ *  @see  sm::split_occ.
  */
-[[nodiscard]] inline constexpr auto operator* (
-    std::string_view string,
-    long      n
-)
+template<fixed_string String, fixed_string Characters>
+[[nodiscard]] consteval auto split_occ()
 {
-    return sm::repeat(string, n);
+    constexpr std::string_view string     = String;
+    constexpr std::string_view characters = Characters;
+    constexpr std::size_t      count      =
+        cu::count_split_occ(string, characters);
+    return impl::to_views<count>(cu::views::split_occ(string, characters));
 }
 
 /**
- *  @brief  Repeat string @c n times.
+ *  @brief  Split the string literal with value at compile time.
  *
- *  @param  string  A string.
- *  @param  n       The number of times to repeat.
- *  @return  Repeated string as @c std::string .
+ *  @tparam  String     A string literal.
+ *  @tparam  Character  A character to split with.
+ *  @return  Array of the pieces as @c std::string_view , viewing @c String .
  *
- *  @see  sm::repeat.
+ *  @see  sm::split.
  */
-[[nodiscard]] inline constexpr auto operator* (
-    std::string_view string,
-    long long      n
-)
+template<fixed_string String, char Character>
+[[nodiscard]] consteval auto split()
 {
-    return sm::repeat(string, n);
+    constexpr std::string_view string = String;
+    constexpr std::size_t      count  = cu::count_split(string, Character);
+    return impl::to_views<count>(cu::views::split(string, Character));
 }
 
 /**
- *  @brief  Repeat string @c n times.
+ *  @brief  Filter out the occurrences of sequence from the string literal at
+ *          compile time.
  *
- *  @param  string  A string.
- *  @param  n       The number of times to repeat.
- *  @return  Repeated string as @c std::string .
+ *  @tparam  String   A string literal.
+ *  @tparam  Pattern  A sequence to remove.
+ *  @return  Filtered string as @c fixed_string .
  *
- *  @see  sm::repeat.
+ *  @see  sm::filter_out_seq.
  */
-[[nodiscard]] inline constexpr auto operator* (
-    std::string_view string,
-    unsigned long long      n
-)
+template<fixed_string String, fixed_string Pattern>
+[[nodiscard]] consteval auto filter_out_seq()
 {
-    return sm::repeat(string, n);
+    constexpr std::string_view string  = String;
+    constexpr std::string_view pattern = Pattern;
+    constexpr std::size_t      size    =
+        cu::filtered_size_seq(string, pattern);
+    return impl::to_fixed<size>(cu::views::split_seq(string, pattern));
 }
 
 /**
- *  @brief  Repeat string @c n times.
+ *  @brief  Filter out the occurrences of any of characters from the string
+ *          literal at compile time.
  *
- *  @param  string  A string.
- *  @param  n       The number of times to repeat.
- *  @return  Repeated string as @c std::string .
+ *  @tparam  String      A string literal.
+ *  @tparam  Characters  The characters to remove.
+ *  @return  Filtered string as @c fixed_string .
+ *
+ *  @see  sm::filter_out_occ.
+ */
+template<fixed_string String, fixed_string Characters>
+[[nodiscard]] consteval auto filter_out_occ()
+{
+    constexpr std::string_view string     = String;
+    constexpr std::string_view characters = Characters;
+    constexpr std::size_t      size       =
+        cu::filtered_size_occ(string, characters);
+    return impl::to_fixed<size>(cu::views::split_occ(string, characters));
+}
+
+/**
+ *  @brief  Filter out the occurrences of character from the string literal at
+ *          compile time.
+ *
+ *  @tparam  String     A string literal.
+ *  @tparam  Character  A character to remove.
+ *  @return  Filtered string as @c fixed_string .
+ *
+ *  @see  sm::filter_out.
+ */
+template<fixed_string String, char Character>
+[[nodiscard]] consteval auto filter_out()
+{
+    constexpr std::string_view string = String;
+    constexpr std::size_t      size   = cu::filtered_size(string, Character);
+    return impl::to_fixed<size>(cu::views::split(string, Character));
+}
+
+/**
+ *  @brief  Repeat string literal @c N times at compile time.
+ *
+ *  @tparam  String  A string literal.
+ *  @tparam  N       The number of times to repeat, of arithmetic type.
+ *  @return  Repeated string as @c fixed_string .
  *
  *  @see  sm::repeat.
  */
-[[nodiscard]] inline constexpr auto operator* (
+template<fixed_string String, auto N>
+requires(std::is_arithmetic_v<decltype(N)>)
+[[nodiscard]] consteval auto repeat()
+{
+    constexpr std::string_view string = String;
+    constexpr std::size_t      size   = cu::repeat_size(string.size(), N);
+
+    fixed_string<size + 1> result = {};
+    cu::repeat_into(string, N, result.characters.begin());
+    return result;
+}
+
+/**
+ *  @brief  Make SM operators build an expression instead of a string.
+ *
+ *  @c + and @c * on the result are evaluated in one allocation when the
+ *  expression is converted to @c std::string , or written straight into the
+ *  output of @c std::format , e.g. @c sm::lazy(" ") * n + "^" .  Lvalue
+ *  strings are held by reference.
+ *
+ *  @tparam  String  A type convertible to @c std::string_view .
+ *  @param   string  A string.
+ *  @return  The string as @c cu::operand_expression , evaluating to
+ *           @c std::string .
+ */
+template<typename String>
+requires(std::is_convertible_v<const String &, std::string_view>)
+[[nodiscard]] inline constexpr auto lazy(String &&string)
+{
+    return cu::operand_expression<std::string,
+        cu::impl::operand_storage<String, char>>(
+        std::forward<String>(string));
+}
+
+} // namespace sm
+
+/**
+ *  @brief  String Manipulators, operators version.
+ */
+namespace sm_operators {
+
+/**
+ *  @brief  Filter out the occurrences of sequence from the string.
+ *
+ *  @param  string   A string.
+ *  @param  pattern  A sequence to remove.
+ *  @return  Filtered string as @c std::string .
+ *
+ *  @see  sm::filter_out_seq.
+ */
+[[nodiscard]] inline constexpr auto operator- (
     std::string_view string,
-    long double      n
+    std::string_view pattern
 )
 {
-    return sm::repeat(string, n);
+    return sm::filter_out_seq(string, pattern);
 }
 
 /**
- *  @brief  Repeat string @c n times.
+ *  @brief  Filter out the occurrences of character from the string.
  *
- *  @param  string  A string.
- *  @param  n       The number of times to repeat.
- *  @return  Repeated string as @c std::string .
+ *  @param  string     A string.
+ *  @param  character  A character to remove.
+ *  @return  Filtered string as @c std::string .
  *
- *  @see  sm::repeat.
+ *  @see  sm::filter_out.
  */
-[[nodiscard]] inline constexpr auto operator* (
+[[nodiscard]] inline constexpr auto operator- (
     std::string_view string,
-    float      n
+    char             character
 )
 {
-    return sm::repeat(string, n);
+    return sm::filter_out(string, character);
 }
 
 /**
  *  @brief  Repeat string @c n times.
  *
- *  @param  string  A string.
- *  @param  n       The number of times to repeat.
+ *  @tparam  String  A type convertible to @c std::string_view .
+ *  @tparam  Number  An arithmetic type.
+ *  @param   string  A string.
+ *  @param   n       The number of times to repeat.
  *  @return  Repeated string as @c std::string .
  *
  *  @see  sm::repeat.
  */
+template<typename String, typename Number>
+requires(std::is_convertible_v<const String &, std::string_view>
+      && std::is_arithmetic_v<Number>)
 [[nodiscard]] inline constexpr auto operator* (
-    std::string_view string,
-    double      n
-)
+    const String &string,
+    Number        n
+) -> std::string
 {
-    return sm::repeat(string, n);
+    // Evaluated right away, a string result converts to std::string_view
+    return cu::repeat_expression<std::string, std::string_view>(
+        std::string_view(string), n);
 }
 
 /**
@@ -67,6 +67,8 @@ namespace cu {
  *
  *  @deprecated  This class is deprecated due to no found value due to an
  *               @c auspicious_library::cu::enumerated_array already exists.
+ *               Use @c auspicious_library::cu::enumerated_optional_map for
+ *               keys that may be absent.
  */
 template<cu_compatible_enum Key, typename T,
     typename Compare = std::less<std::underlying_type_t<Key>>,
@@ -1100,7 +1100,7 @@ static inline constexpr auto combine_option_description(
 )
 {
     std::vector<std::string> result = {};
-    auto wrapped_desc = sm::word_wrap(desc, desc_wrap_width);
+    auto wrapped_desc = sm::word_wrap_views(desc, desc_wrap_width);
 
     bool offset_by_one = false;
     if (ons_width > pad_desc.width && !option_lines.empty())
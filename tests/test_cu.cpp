@@ -42,8 +42,13 @@
  *    "Standard" (for "Auspicious") and "Small" (for "LIBRARY").
  */
 
+#include <array>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <limits>
+#include <memory_resource>
+#include <stdexcept>
 
 #include "tester.hpp"
 
@@ -416,6 +421,929 @@ using namespace cu_operators;
     T_END;
 }
 
+/**
+ *  @brief  Test CU views' @c split_seq function.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] static auto test_cu_views_split_seq() -> std::size_t
+{
+    T_BEGIN;
+
+    std::vector container = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 5, 6, 7 };
+    std::vector splitter  = { 5, 6, 7 };
+    std::vector<std::vector<int>> expected = {
+        { 1, 2, 3, 4 },
+        { 8, 9, 10 },
+        {}
+    };
+
+    auto view     = cu::views::split_seq(container, splitter);
+    auto splitted = view | stdr::to<std::vector<std::vector<int>>>();
+
+    logln("container: {}", sm::to_string(container));
+    logln("splitter: {}",  sm::to_string(splitter));
+
+    T_ASSERT_NEST_CTR(splitted, expected);
+    T_ASSERT_NEST_CTR(cu::split_seq(container, splitter), expected);
+
+    // Pieces must refer to the container's elements
+    auto first = *view.begin();
+    T_ASSERT((const void *)first.data(), (const void *)container.data(),
+        "Piece is not a view");
+
+    auto sizes = view
+               | stdv::transform([&](auto piece) { return piece.size(); })
+               | stdr::to<std::vector<std::size_t>>();
+    std::vector<std::size_t> expected_sizes = { 4, 3, 0 };
+
+    T_ASSERT_CTR(sizes, expected_sizes);
+
+    T_END;
+}
+
+/**
+ *  @brief  Test CU views' @c split_occ function.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] static auto test_cu_views_split_occ() -> std::size_t
+{
+    T_BEGIN;
+
+    std::vector container = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 4 };
+    std::vector splitter  = { 4, 8 };
+    std::vector<std::vector<int>> expected = {
+        { 1, 2, 3 },
+        { 5, 6, 7 },
+        { 9, 10 }
+    };
+
+    auto view     = cu::views::split_occ(container, splitter);
+    auto splitted = view | stdr::to<std::vector<std::vector<int>>>();
+
+    logln("container: {}", sm::to_string(container));
+    logln("splitter: {}",  sm::to_string(splitter));
+
+    T_ASSERT_NEST_CTR(splitted, expected);
+    T_ASSERT_NEST_CTR(cu::split_occ(container, splitter), expected);
+
+    auto last = *stdr::next(view.begin(), 2);
+    T_ASSERT((const void *)last.data(), (const void *)&container[8],
+        "Piece is not a view");
+
+    T_ASSERT(stdr::empty(cu::views::split_occ(std::vector<int> {}, splitter)),
+        true, "Empty container is not empty");
+
+    T_END;
+}
+
+/**
+ *  @brief  Test CU views' @c split_occ_seq function.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] static auto test_cu_views_split_occ_seq() -> std::size_t
+{
+    T_BEGIN;
+
+    std::vector container = { 1, 2, 3, 3, 4, 5, 6, 7, 8, 8, 9, 10 };
+    std::vector<std::vector<int>> splitter = { { 3, 3 }, {}, { 8, 8 } };
+    std::vector<std::vector<int>> expected = {
+        { 1, 2  },
+        { 4, 5, 6, 7},
+        { 9, 10 }
+    };
+
+    auto view     = cu::views::split_occ_seq(container, splitter);
+    auto splitted = view | stdr::to<std::vector<std::vector<int>>>();
+
+    logln("container: {}",   sm::to_string(container));
+    logln("splitter[0]: {}", sm::to_string(splitter[0]));
+    logln("splitter[2]: {}", sm::to_string(splitter[2]));
+
+    T_ASSERT_NEST_CTR(splitted, expected);
+    T_ASSERT_NEST_CTR(cu::split_occ_seq(container, splitter), expected);
+
+    // A pattern starting before another match but ending after it
+    std::vector overlapped = { 1, 2, 3, 4, 5 };
+    std::vector<std::vector<int>> overlapping = { { 3, 4 }, { 1, 2, 3 } };
+    std::vector<std::vector<int>> expected_overlapped = { {}, { 4, 5 } };
+
+    T_ASSERT_NEST_CTR(cu::split_occ_seq(overlapped, overlapping),
+        expected_overlapped);
+
+    T_END;
+}
+
+/**
+ *  @brief  Test CU views' @c split function.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] static auto test_cu_views_split() -> std::size_t
+{
+    T_BEGIN;
+
+    std::vector container = { 7, 1, 2, 7, 7, 3 };
+    int         splitter  = 7;
+    std::vector<std::vector<int>> expected = {
+        {},
+        { 1, 2 },
+        {},
+        { 3 }
+    };
+
+    auto splitted = cu::views::split(container, splitter)
+                  | stdr::to<std::vector<std::vector<int>>>();
+
+    logln("container: {}", sm::to_string(container));
+    logln("splitter: {}",  splitter);
+
+    T_ASSERT_NEST_CTR(splitted, expected);
+    T_ASSERT_NEST_CTR(cu::split(container, splitter), expected);
+
+    T_END;
+}
+
+/**
+ *  @brief  Test CU's @c multi_searcher struct.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] static auto test_cu_multi_searcher() -> std::size_t
+{
+    T_BEGIN;
+
+    std::vector container = { 1, 2, 3, 4, 5, 2, 3, 6, 3, 4 };
+    std::vector<std::vector<int>> patterns = {
+        { 2, 3 },
+        { 2, 3, 4 },
+        { 3, 4, 5, 9 },
+        { 6 },
+        {}
+    };
+    std::vector<std::vector<int>> expected_split = {
+        { 1 },
+        { 5 },
+        {},
+        { 3, 4 }
+    };
+    std::vector expected_filter = { 1, 5, 3, 4 };
+
+    cu::multi_searcher<std::vector<int>> searcher(patterns);
+
+    logln("container: {}", sm::to_string(container));
+
+    // Leftmost-longest, { 2, 3, 4 } wins over { 2, 3 }
+    auto match = searcher.find(container.data(),
+        container.data() + container.size());
+
+    T_ASSERT((const void *)match.data(), (const void *)&container[1],
+        "Invalid match position");
+    T_ASSERT(match.size(), 3uz, "Invalid match size");
+
+    auto splitted = cu::split_occ_seq(container, searcher);
+    auto filtered = cu::filter_out_occ_seq(container, searcher);
+
+    T_ASSERT_NEST_CTR(splitted, expected_split);
+    T_ASSERT_NEST_CTR(cu::split_occ_seq(container, patterns), expected_split);
+    T_ASSERT_CTR(filtered, expected_filter);
+    T_ASSERT_CTR(cu::filter_out_occ_seq(container, patterns), expected_filter);
+
+    std::vector<std::string> words = { "ab", "abc", "bcd" };
+    std::vector<std::string> expected_words = { "x", "dy", "z" };
+
+    cu::multi_searcher<std::string> word_searcher(words);
+
+    T_ASSERT_CTR(sm::split_occ_seq("xabcdyabz", word_searcher),
+        expected_words);
+    T_ASSERT(sm::filter_out_occ_seq("xabcdyabz", words), "xdyz",
+        "Invalid filtered string");
+
+    T_END;
+}
+
+/**
+ *  @brief  Test CU's @c searcher struct.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] static auto test_cu_searcher() -> std::size_t
+{
+    T_BEGIN;
+
+    std::vector container = { 1, 2, 1, 2, 1, 3, 4, 1, 2, 1, 3 };
+    std::vector splitter  = { 1, 2, 1, 3 };
+    std::vector<std::vector<int>> expected = {
+        { 1, 2 },
+        { 4 },
+        {}
+    };
+    std::vector expected_filter = { 1, 2, 4 };
+
+    cu::searcher<std::vector<int>> searcher(splitter);
+
+    logln("container: {}", sm::to_string(container));
+    logln("splitter: {}",  sm::to_string(splitter));
+
+    T_ASSERT_NEST_CTR(cu::split_seq(container, searcher), expected);
+    T_ASSERT_CTR(cu::filter_out_seq(container, searcher), expected_filter);
+
+    std::string string   = "one, two,, three, ";
+    std::string pattern  = ", ";
+    std::vector<std::string> expected_words = { "one", "two,", "three", "" };
+
+    cu::searcher<std::string> string_searcher(pattern);
+    cu::searcher<std::string> char_searcher(std::string(","));
+
+    T_ASSERT_CTR(sm::split_seq(string, string_searcher), expected_words);
+    T_ASSERT_CTR(sm::split_seq(string, pattern), expected_words);
+    T_ASSERT(sm::filter_out_seq(string, char_searcher), "one two three ",
+        "Invalid filtered string");
+
+    T_END;
+}
+
+/**
+ *  @brief  Test CU's @c byte_set struct.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] static auto test_cu_byte_set() -> std::size_t
+{
+    T_BEGIN;
+
+    // Pseudo-random bytes, long enough for every kernel and its tail
+    std::vector<unsigned char> bytes(301);
+    std::uint32_t state = 12345;
+    for (auto &byte : bytes)
+    {
+        state = state * 1103515245 + 12345;
+        byte  = (unsigned char)(state >> 24);
+    }
+
+    std::vector<std::vector<unsigned char>> sets = {
+        {},
+        { 0xff },
+        { ',', ';', 0x80 },
+        { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 0xf0 }
+    };
+
+    for (const auto &values : sets)
+    {
+        cu::byte_set set(values);
+
+        for (std::size_t start = 0; start < bytes.size(); start += 7)
+        {
+            auto first = bytes.data() + start;
+            auto last  = bytes.data() + bytes.size();
+
+            auto found    = set.find(first, last);
+            auto expected = std::find_first_of(first, last, values.begin(),
+                values.end());
+            T_ASSERT(found - first, expected - first, "Invalid match");
+        }
+
+        std::vector<unsigned char> expected_filter = {};
+        for (auto byte : bytes)
+        {
+            if (std::ranges::find(values, byte) == values.end())
+            {
+                expected_filter.push_back(byte);
+            }
+        }
+        T_ASSERT_CTR(cu::filter_out_occ(bytes, values), expected_filter);
+    }
+
+    cu::byte_set set(std::string_view(",;"));
+    T_ASSERT(set.contains(','), true, "Value not in set");
+    T_ASSERT(set.contains('.'), false, "Value in set");
+    T_ASSERT(set.count, 2, "Invalid set size");
+
+    std::string string = "one,two;three";
+    std::vector<std::string> expected_words = { "one", "two", "three" };
+    T_ASSERT_CTR(sm::split_occ(string, ",;"), expected_words);
+    T_ASSERT(sm::filter_out_occ(string, ",;"), "onetwothree",
+        "Invalid filtered string");
+
+    T_END;
+}
+
+/**
+ *  @brief  Test CU's @c jagged struct.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] static auto test_cu_jagged() -> std::size_t
+{
+    T_BEGIN;
+
+    std::vector container = { 1, 2, 3, 0, 4, 0, 0, 5, 6 };
+    std::vector splitter  = { 0 };
+    std::vector<std::vector<int>> patterns = { { 0 } };
+    std::vector<std::vector<int>> expected = {
+        { 1, 2, 3 },
+        { 4 },
+        {},
+        { 5, 6 }
+    };
+
+    auto splitted = cu::split_seq<cu::jagged<int>>(container, splitter);
+
+    logln("container: {}", sm::to_string(container));
+    logln("splitter: {}",  sm::to_string(splitter));
+
+    T_ASSERT_SIZE(splitted, expected);
+    T_ASSERT(splitted.values.size(), 6uz, "Values are not contiguous");
+
+    for (std::size_t i = 0; i < expected.size(); i++)
+    {
+        T_ASSERT(stdr::equal(splitted[i], expected[i]), true,
+            std::format("Invalid piece {}", i));
+    }
+
+    auto sizes = splitted
+               | stdv::transform([&](auto piece) { return piece.size(); })
+               | stdr::to<std::vector<std::size_t>>();
+    std::vector<std::size_t> expected_sizes = { 3, 1, 0, 2 };
+
+    T_ASSERT_CTR(sizes, expected_sizes);
+    T_ASSERT((splitted.end() - splitted.begin()), 4, "Invalid distance");
+
+    T_ASSERT_NEST_CTR(splitted.to_nested(), expected);
+    T_ASSERT_NEST_CTR(cu::split<cu::jagged<int>>(container, 0).to_nested(),
+        expected);
+    T_ASSERT_NEST_CTR(
+        cu::split_occ<cu::jagged<int>>(container, splitter).to_nested(),
+        expected);
+    T_ASSERT_NEST_CTR(
+        cu::split_occ_seq<cu::jagged<int>>(container, patterns).to_nested(),
+        expected);
+    T_ASSERT_NEST_CTR((cu::as_jagged(container) / splitter).to_nested(),
+        expected);
+    T_ASSERT_NEST_CTR((cu::as_jagged(container) / 0).to_nested(), expected);
+
+    T_END;
+}
+
+/**
+ *  @brief  Test CU's allocator support.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] static auto test_cu_allocator() -> std::size_t
+{
+    T_BEGIN;
+
+    std::array<std::byte, 1024>         buffer   = {};
+    std::pmr::monotonic_buffer_resource resource(buffer.data(), buffer.size());
+
+    std::vector container = { 1, 2, 3, 0, 4, 5, 0, 6 };
+    std::vector splitter  = { 0 };
+    std::vector<std::vector<int>> expected_split = {
+        { 1, 2, 3 },
+        { 4, 5 },
+        { 6 }
+    };
+    std::vector expected_filter = { 1, 2, 3, 4, 5, 6 };
+    std::vector expected_repeat = { 1, 2, 3, 0, 4, 5, 0, 6, 1, 2, 3, 0 };
+
+    auto splitted = cu::split_seq(container, splitter, &resource);
+    auto filtered = cu::filter_out_occ(container, splitter,
+        std::pmr::polymorphic_allocator<int>(&resource));
+    auto repeated = cu::repeat(container, 1.5, &resource);
+
+    logln("container: {}", sm::to_string(container));
+
+    T_ASSERT_NEST_CTR(splitted, expected_split);
+    T_ASSERT_CTR(filtered, expected_filter);
+    T_ASSERT_CTR(repeated, expected_repeat);
+
+    T_ASSERT((void *)splitted.get_allocator().resource(), (void *)&resource,
+        "Split container does not use the resource");
+    T_ASSERT((void *)splitted[1].get_allocator().resource(),
+        (void *)&resource, "Split piece does not use the resource");
+    T_ASSERT((void *)filtered.get_allocator().resource(), (void *)&resource,
+        "Filtered container does not use the resource");
+    T_ASSERT((void *)repeated.get_allocator().resource(), (void *)&resource,
+        "Repeated container does not use the resource");
+
+    auto appended = cu::combine(container, 7, &resource);
+    auto removed  = cu::filter_out(container, 0, &resource);
+
+    T_ASSERT(appended.back(), 7, "Value was not appended");
+    T_ASSERT_CTR(removed, expected_filter);
+    T_ASSERT((void *)appended.get_allocator().resource(), (void *)&resource,
+        "Value-combined container does not use the resource");
+    T_ASSERT((void *)removed.get_allocator().resource(), (void *)&resource,
+        "Value-filtered container does not use the resource");
+
+    std::pmr::vector<int> pmr_container(container.begin(), container.end(),
+        &resource);
+    std::pmr::vector<int> pmr_splitter(splitter.begin(), splitter.end(),
+        &resource);
+
+    auto combined = pmr_container + pmr_splitter;
+
+    T_ASSERT(combined.size(), container.size() + 1, "Invalid combined size");
+    T_ASSERT((void *)combined.get_allocator().resource(), (void *)&resource,
+        "Operator result does not follow the left container");
+
+    T_END;
+}
+
+/**
+ *  @brief  Test CU's @c _into functions.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] static auto test_cu_into() -> std::size_t
+{
+    T_BEGIN;
+
+    std::vector container = { 1, 2, 3, 4, 1, 2 };
+    std::vector pattern   = { 1, 2 };
+    std::vector<std::vector<int>> patterns = { { 1 }, { 4 } };
+    std::vector expected_filter  = { 9, 3, 4 };
+    std::vector expected_occ     = { 9, 3, 4 };
+    std::vector expected_occ_seq = { 9, 2, 3, 2 };
+    std::vector expected_value   = { 9, 1, 3, 4, 1 };
+    std::vector expected_repeat  = { 9, 1, 2, 3, 4, 1, 2, 1, 2, 3 };
+    std::vector expected_combine = { 9, 1, 2, 3, 4, 1, 2, 1, 2, 5 };
+    std::vector expected_sub     = { 9, 2, 3 };
+
+    std::vector<int> buffer = {};
+    buffer.reserve(64);
+    auto data = buffer.data();
+
+    logln("container: {}", sm::to_string(container));
+
+    // Reuse the buffer and check that nothing was reallocated
+    buffer = { 9 };
+    auto end = cu::filter_out_seq_into(container, pattern, buffer);
+    T_ASSERT_CTR(buffer, expected_filter);
+    T_ASSERT(end - buffer.begin(), 3, "Invalid end position");
+
+    buffer = { 9 };
+    cu::filter_out_occ_into(container, std::vector { 1, 2 }, buffer);
+    T_ASSERT_CTR(buffer, expected_occ);
+
+    buffer = { 9 };
+    cu::filter_out_occ_seq_into(container, patterns, buffer);
+    T_ASSERT_CTR(buffer, expected_occ_seq);
+
+    buffer = { 9 };
+    cu::filter_out_into(container, 2, buffer);
+    T_ASSERT_CTR(buffer, expected_value);
+
+    buffer = { 9 };
+    cu::repeat_into(container, 1.5, buffer);
+    T_ASSERT_CTR(buffer, expected_repeat);
+
+    buffer = { 9 };
+    cu::combine_into(cu::combine(container, pattern), 5, buffer);
+    T_ASSERT_CTR(buffer, expected_combine);
+
+    buffer = { 9 };
+    cu::subordinate_into(container, 1, 3, buffer);
+    T_ASSERT_CTR(buffer, expected_sub);
+
+    T_ASSERT((void *)buffer.data(), (void *)data, "Buffer was reallocated");
+
+    // Output iterator
+    std::array<int, 4> array = {};
+    auto it = cu::filter_out_into(container, 1, array.begin());
+    T_ASSERT(it - array.begin(), 4, "Invalid end position");
+
+    T_END;
+}
+
+/**
+ *  @brief  Element that counts how many times it was copy-assigned.
+ */
+struct copy_counted {
+
+    /**
+     *  @brief  The value.
+     */
+    int value = 0;
+
+    /**
+     *  @brief  The number of copy-assignments of all the elements.
+     */
+    static inline std::size_t copies = 0;
+
+    copy_counted(int number) : value(number) {}
+
+    copy_counted(const copy_counted &) = default;
+    copy_counted(copy_counted &&)      = default;
+
+    auto operator= (copy_counted &&) -> copy_counted & = default;
+
+    auto operator= (const copy_counted &other) -> copy_counted &
+    {
+        value = other.value;
+        copies++;
+        return *this;
+    }
+
+    [[nodiscard]] auto operator== (const copy_counted &other) const -> bool
+    {
+        return value == other.value;
+    }
+};
+
+/**
+ *  @brief  Get the values of copy counted elements.
+ *
+ *  @param   counted  The copy counted elements.
+ *  @return  The values.
+ */
+[[nodiscard]] static auto counted_values(
+    const std::vector<copy_counted> &counted
+) -> std::vector<int>
+{
+    std::vector<int> values = {};
+    for (const copy_counted &element : counted)
+    {
+        values.push_back(element.value);
+    }
+    return values;
+}
+
+/**
+ *  @brief  Test CU's @c _inplace functions.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] static auto test_cu_inplace() -> std::size_t
+{
+    T_BEGIN;
+
+    std::vector container = { 1, 2, 3, 4, 1, 2 };
+    std::vector pattern   = { 1, 2 };
+    std::vector<std::vector<int>> patterns = { { 1 }, { 4 } };
+    std::vector expected_filter  = { 3, 4 };
+    std::vector expected_occ     = { 3, 4 };
+    std::vector expected_occ_seq = { 2, 3, 2 };
+    std::vector expected_value   = { 1, 3, 4, 1 };
+    std::vector expected_repeat  = { 1, 2, 3, 4, 1, 2, 1, 2, 3 };
+    std::vector expected_partial = { 1, 2, 3 };
+    std::vector<std::vector<int>> expected_split = { {}, { 3, 4 }, {} };
+    std::vector<std::vector<int>> expected_split_value = { { 1 }, { 3, 4, 1 },
+        {} };
+
+    logln("container: {}", sm::to_string(container));
+
+    auto buffer = container;
+    T_ASSERT(cu::filter_out_seq_inplace(buffer, pattern), 4,
+        "Invalid number of removed elements");
+    T_ASSERT_CTR(buffer, expected_filter);
+
+    buffer = container;
+    cu::filter_out_occ_inplace(buffer, pattern);
+    T_ASSERT_CTR(buffer, expected_occ);
+
+    buffer = container;
+    cu::filter_out_occ_seq_inplace(buffer, patterns);
+    T_ASSERT_CTR(buffer, expected_occ_seq);
+
+    buffer = container;
+    cu::filter_out_inplace(buffer, 2);
+    T_ASSERT_CTR(buffer, expected_value);
+
+    buffer = container;
+    cu::repeat_inplace(buffer, 1.5);
+    T_ASSERT_CTR(buffer, expected_repeat);
+
+    buffer = container;
+    cu::repeat_inplace(buffer, 0.5);
+    T_ASSERT_CTR(buffer, expected_partial);
+
+    // Short strings grow out of their inline buffer while repeating
+    std::string text = "abc";
+    cu::repeat_inplace(text, 7.5);
+    T_ASSERT(text, "abcabcabcabcabcabcabca", "Invalid repeated string");
+
+    // Split reuses the buffer
+    buffer    = container;
+    auto data = buffer.data();
+    auto split = cu::split_seq_inplace(std::move(buffer), pattern);
+    T_ASSERT_NEST_CTR(split.to_nested(), expected_split);
+    T_ASSERT((void *)split.values.data(), (void *)data,
+        "Buffer was not reused");
+
+    buffer = container;
+    auto split_value = cu::split_inplace(std::move(buffer), 2);
+    T_ASSERT_NEST_CTR(split_value.to_nested(), expected_split_value);
+
+    // Kept elements are moved, not copied
+    std::vector<copy_counted> counted = { 1, 2, 3, 2, 4 };
+    std::vector<copy_counted> counted_pattern = { 2 };
+    std::vector expected_counted = { 1, 3, 4 };
+
+    copy_counted::copies = 0;
+    cu::filter_out_seq_inplace(counted, counted_pattern);
+    T_ASSERT_CTR(counted_values(counted), expected_counted);
+    T_ASSERT(copy_counted::copies, 0, "Kept elements were copied");
+
+    counted = { 1, 2, 3, 2, 4 };
+    copy_counted::copies = 0;
+    auto split_counted = cu::split_inplace(std::move(counted), 2);
+    T_ASSERT_CTR(counted_values(split_counted.values), expected_counted);
+    T_ASSERT(copy_counted::copies, 0, "Split elements were copied");
+
+    T_END;
+}
+
+/**
+ *  @brief  Test CU's parallel execution-policy overloads.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] static auto test_cu_parallel() -> std::size_t
+{
+    T_BEGIN;
+
+    std::size_t size = cu::parallel_threshold * 4 + 3;
+
+    std::vector<int> numbers(size);
+    for (std::size_t i = 0; i < size; i++)
+    {
+        numbers[i] = (int)(i % 7);
+    }
+
+    std::vector<char> characters(size);
+    for (std::size_t i = 0; i < size; i++)
+    {
+        characters[i] = "ab,c;de"[i % 7];
+    }
+
+    // Leading and trailing delimiters
+    std::vector<int> delimited = numbers;
+    delimited.front() = 6;
+    delimited.back()  = 6;
+
+    std::vector number_values    = { 3, 6 };
+    std::vector character_values = { ',', ';' };
+
+    // Forced thread counts split even on a single core machine, so the
+    // pieces are stitched across chunk boundaries
+    auto policies = {
+        cu::execution::par, cu::execution::par(3), cu::execution::par(7)
+    };
+
+    for (auto par : policies)
+    {
+        auto combined          = cu::combine(par, numbers, delimited);
+        auto combined_expected = cu::combine(numbers, delimited);
+        T_ASSERT_CTR(combined, combined_expected);
+
+        auto repeated          = cu::repeat(par, numbers, 2.5);
+        auto repeated_expected = cu::repeat(numbers, 2.5);
+        T_ASSERT_CTR(repeated, repeated_expected);
+
+        auto filtered = cu::filter_out_occ(par, numbers, number_values);
+        auto filtered_expected = cu::filter_out_occ(numbers, number_values);
+        T_ASSERT_CTR(filtered, filtered_expected);
+
+        auto filtered_characters =
+            cu::filter_out_occ(par, characters, character_values);
+        auto filtered_characters_expected =
+            cu::filter_out_occ(characters, character_values);
+        T_ASSERT_CTR(filtered_characters, filtered_characters_expected);
+
+        auto split          = cu::split_occ(par, delimited, number_values);
+        auto split_expected = cu::split_occ(delimited, number_values);
+        T_ASSERT_NEST_CTR(split, split_expected);
+
+        auto split_characters =
+            cu::split_occ(par, characters, character_values);
+        auto split_characters_expected =
+            cu::split_occ(characters, character_values);
+        T_ASSERT_NEST_CTR(split_characters, split_characters_expected);
+    }
+
+    // Values right at the boundaries of chunks
+    std::vector<int> small = { 6, 1, 6, 6, 2, 3, 6, 4 };
+    auto split_small          = cu::split_occ(cu::execution::par(4), small,
+        number_values);
+    auto split_small_expected = cu::split_occ(small, number_values);
+    T_ASSERT_NEST_CTR(split_small, split_small_expected);
+
+    auto filtered_small          = cu::filter_out_occ(cu::execution::par(4),
+        small, number_values);
+    auto filtered_small_expected = cu::filter_out_occ(small, number_values);
+    T_ASSERT_CTR(filtered_small, filtered_small_expected);
+
+    // Pieces are allocated on the calling thread only
+    std::array<std::byte, 1024>         buffer   = {};
+    std::pmr::monotonic_buffer_resource resource(buffer.data(), buffer.size());
+
+    auto split_resource = cu::split_occ(cu::execution::par(4), small,
+        number_values, &resource);
+    T_ASSERT_NEST_CTR(split_resource, split_small_expected);
+    T_ASSERT((void *)split_resource[1].get_allocator().resource(),
+        (void *)&resource, "Split piece does not use the resource");
+
+    // Sequenced policy runs the serial algorithm
+    auto sequenced = cu::repeat(cu::execution::seq, numbers, 2);
+    auto sequenced_expected = cu::repeat(numbers, 2);
+    T_ASSERT_CTR(sequenced, sequenced_expected);
+
+    T_END;
+}
+
+/**
+ *  @brief  Test CU's @c stream_splitter .
+ *  @return  Number of errors.
+ */
+[[nodiscard]] static auto test_cu_stream_splitter() -> std::size_t
+{
+    T_BEGIN;
+
+    std::vector<int> container = { 1, 2, 3, 1, 2, 3, 4, 5, 2, 3, 1, 2 };
+    std::vector<int> pattern   = { 1, 2 };
+    std::vector<int> values    = { 3, 1 };
+    std::vector<std::vector<int>> patterns = { { 1, 2, 3, 4 }, { 2, 3 } };
+
+    logln("container: {}", sm::to_string(container));
+
+    // Feed the container in chunks of chunk_size elements
+    auto collect = [&](auto splitter, std::size_t chunk_size)
+    {
+        std::vector<std::vector<int>> pieces = {};
+        auto push = [&](std::span<const int> piece)
+        {
+            pieces.emplace_back(piece.begin(), piece.end());
+        };
+
+        for (std::size_t i = 0; i < container.size(); i += chunk_size)
+        {
+            std::size_t count = std::min(chunk_size, container.size() - i);
+            std::span<const int> chunk(container.data() + i, count);
+            splitter.feed(chunk, push);
+        }
+        splitter.finish(push);
+        return pieces;
+    };
+
+    auto expected_seq     = cu::split_seq(container, pattern);
+    auto expected_occ     = cu::split_occ(container, values);
+    auto expected_occ_seq = cu::split_occ_seq(container, patterns);
+    auto expected_value   = cu::split(container, 2);
+
+    for (std::size_t size = 1; size <= container.size(); size++)
+    {
+        logln("chunk size: {}", size);
+
+        auto seq = collect(cu::stream_split_seq(pattern), size);
+        T_ASSERT_NEST_CTR(seq, expected_seq);
+
+        auto occ = collect(cu::stream_split_occ(values), size);
+        T_ASSERT_NEST_CTR(occ, expected_occ);
+
+        auto occ_seq = collect(cu::stream_split_occ_seq(patterns), size);
+        T_ASSERT_NEST_CTR(occ_seq, expected_occ_seq);
+
+        auto value = collect(cu::stream_split(2), size);
+        T_ASSERT_NEST_CTR(value, expected_value);
+    }
+
+    // Only the unfinished piece is kept
+    auto        splitter = cu::stream_split(4);
+    std::size_t count    = 0;
+    auto        counter  = [&](std::span<const int>) { count++; };
+    splitter.feed(container, counter);
+    T_ASSERT(count, 1, "Invalid number of pieces");
+    T_ASSERT(splitter.buffer.size(), 5, "Invalid size of unfinished piece");
+
+    splitter.finish(counter);
+    T_ASSERT(count, 2, "Invalid number of pieces");
+    T_ASSERT(splitter.buffer.size(), 0, "Splitter was not reset");
+
+    T_END;
+}
+
+/**
+ *  @brief  Test CU's size queries.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] static auto test_cu_size_queries() -> std::size_t
+{
+    T_BEGIN;
+
+    std::vector container = { 1, 2, 3, 1, 2, 3, 4, 5, 2, 3, 1, 2 };
+    std::vector pattern   = { 1, 2 };
+    std::vector values    = { 3, 1 };
+    std::vector<std::vector<int>> patterns = { { 1, 2, 3, 4 }, { 2, 3 } };
+    std::vector<char> characters = { 'a', ',', 'b', ',', ',' };
+    std::vector<char> comma      = { ',' };
+
+    logln("container: {}", sm::to_string(container));
+
+    auto split_seq     = cu::split_seq(container, pattern);
+    auto split_occ     = cu::split_occ(container, values);
+    auto split_occ_seq = cu::split_occ_seq(container, patterns);
+    auto split_value   = cu::split(container, 2);
+    auto split_chars   = cu::split_occ(characters, comma);
+
+    T_ASSERT(cu::count_split_seq(container, pattern), split_seq.size(),
+        "Invalid number of pieces");
+    T_ASSERT(cu::count_split_occ(container, values), split_occ.size(),
+        "Invalid number of pieces");
+    T_ASSERT(cu::count_split_occ_seq(container, patterns),
+        split_occ_seq.size(), "Invalid number of pieces");
+    T_ASSERT(cu::count_split(container, 2), split_value.size(),
+        "Invalid number of pieces");
+    T_ASSERT(cu::count_split_occ(characters, comma), split_chars.size(),
+        "Invalid number of pieces");
+
+    auto filter_seq     = cu::filter_out_seq(container, pattern);
+    auto filter_occ     = cu::filter_out_occ(container, values);
+    auto filter_occ_seq = cu::filter_out_occ_seq(container, patterns);
+    auto filter_value   = cu::filter_out(container, 2);
+    auto filter_chars   = cu::filter_out_occ(characters, comma);
+
+    T_ASSERT(cu::filtered_size_seq(container, pattern), filter_seq.size(),
+        "Invalid filtered size");
+    T_ASSERT(cu::filtered_size_occ(container, values), filter_occ.size(),
+        "Invalid filtered size");
+    T_ASSERT(cu::filtered_size_occ_seq(container, patterns),
+        filter_occ_seq.size(), "Invalid filtered size");
+    T_ASSERT(cu::filtered_size(container, 2), filter_value.size(),
+        "Invalid filtered size");
+    T_ASSERT(cu::filtered_size_occ(characters, comma), filter_chars.size(),
+        "Invalid filtered size");
+
+    auto repeated = cu::repeat(container, 2.5);
+    T_ASSERT(cu::repeat_size(container.size(), 2.5), repeated.size(),
+        "Invalid repeated size");
+    T_ASSERT(cu::repeat_size(container.size(), -1), 0,
+        "Invalid repeated size");
+
+    // Invalid floating-point numbers repeat zero times or are clamped
+    T_ASSERT(cu::repeat_size(container.size(), -2.5), 0,
+        "Invalid repeated size");
+    T_ASSERT(cu::repeat_size(container.size(),
+        std::numeric_limits<double>::quiet_NaN()), 0,
+        "Invalid repeated size");
+    T_ASSERT(cu::repeat_size(0, 1e30), 0, "Invalid repeated size");
+
+    T_END;
+}
+
+/**
+ *  @brief  Test CU operators' expressions.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] static auto test_cu_expression() -> std::size_t
+{
+    T_BEGIN;
+
+    std::vector a = { 1, 2 };
+    std::vector b = { 3 };
+    std::vector c = { 4, 5 };
+    std::vector x = { 5, 4 };
+    std::vector y = { 1, 5, 4, 2, 3 };
+    std::vector expected_chain   = { 1, 2, 3, 4, 5 };
+    std::vector expected_repeat  = { 0, 1, 2, 3, 1, 2, 3, 1 };
+    std::vector expected_owned   = { 7, 8, 3 };
+    std::vector expected_reverse = { 1, 2, 3 };
+    std::vector<std::vector<int>> expected_split = { { 1 }, { 3 } };
+
+    auto chain = cu::lazy(a) + b + cu::lazy(c) * 3;
+    T_ASSERT(chain.size(), 9, "Invalid expression size");
+
+    std::vector<int> result = chain - x;
+    logln("result: {}", sm::to_string(result));
+    T_ASSERT_CTR(result, expected_chain);
+
+    std::vector<int> repeated = 0 + (cu::lazy(a) + b) * 2.4;
+    logln("repeated: {}", sm::to_string(repeated));
+    T_ASSERT_CTR(repeated, expected_repeat);
+
+    // Temporaries are owned by the expression
+    auto owned = cu::lazy(std::vector { 7, 8 }) + b;
+    T_ASSERT_CTR(owned.evaluate(), expected_owned);
+
+    std::vector<int> reverse = y - cu::lazy(x) * 1;
+    T_ASSERT_CTR(reverse, expected_reverse);
+
+    auto split = (cu::lazy(a) + b) / 2;
+    T_ASSERT_NEST_CTR(split, expected_split);
+
+    // Writing does not allocate
+    std::array<int, 9> array = {};
+    auto end = chain.write(array.begin());
+    T_ASSERT(end - array.begin(), 9, "Invalid end position");
+    T_ASSERT(array[8], 5, "Invalid last element");
+
+    // Sizes follow operands changed after building the expression
+    std::vector d                = { 1, 2 };
+    std::vector e                = { 3 };
+    std::vector expected_changed = { 3, 4, 3, 4 };
+
+    auto changed = cu::lazy(d) + cu::lazy(e) * 2;
+    d.clear();
+    e.push_back(4);
+
+    std::vector<int> changed_result = changed;
+    T_ASSERT(changed.size(), 4, "Invalid size after change");
+    T_ASSERT_CTR(changed_result, expected_changed);
+
+    T_END;
+}
+
 /**
  *  @brief  Test CU operators' @c operator+ (overload 1).
  *  @return  Number of errors.
@@ -665,12 +1593,60 @@ using namespace cu_operators;
  */
 [[nodiscard]] auto test_cu_containers_boundless_string_view() -> std::size_t;
 
+/**
+ *  @brief  Test CU containers' @c boundless_ring struct.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] auto test_cu_containers_boundless_ring() -> std::size_t;
+
+/**
+ *  @brief  Test CU containers' @c boundless_deque struct.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] auto test_cu_containers_boundless_deque() -> std::size_t;
+
+/**
+ *  @brief  Test CU containers' enumerator names.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] auto test_cu_containers_enum_names() -> std::size_t;
+
 /**
  *  @brief  Test CU containers' @c enumerated_array struct.
  *  @return  Number of errors.
  */
 [[nodiscard]] auto test_cu_containers_enumerated_array() -> std::size_t;
 
+/**
+ *  @brief  Test CU containers' @c enumerated_array_nd struct.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] auto test_cu_containers_enumerated_array_nd() -> std::size_t;
+
+/**
+ *  @brief  Test CU containers' @c enumerated_soa struct.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] auto test_cu_containers_enumerated_soa() -> std::size_t;
+
+/**
+ *  @brief  Test CU containers' @c enumerated_bitset struct.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] auto test_cu_containers_enumerated_bitset() -> std::size_t;
+
+/**
+ *  @brief  Test CU containers' @c enumerated_optional_map struct.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] auto test_cu_containers_enumerated_optional_map() -> std::size_t;
+
+/**
+ *  @brief  Test CU containers' @c small_vector struct.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] auto test_cu_containers_small_vector() -> std::size_t;
+
 /**
  *  @brief  Test... copper?  No wait, test Container Utilities.
  *  @return  Number of errors.
@@ -768,6 +1744,96 @@ using namespace cu_operators;
         test_cu_split
     });
 
+    suite.tests.emplace_back(new test {
+        "Test CU views' split_seq function",
+        "test_cu_views_split_seq",
+        test_cu_views_split_seq
+    });
+
+    suite.tests.emplace_back(new test {
+        "Test CU views' split_occ function",
+        "test_cu_views_split_occ",
+        test_cu_views_split_occ
+    });
+
+    suite.tests.emplace_back(new test {
+        "Test CU views' split_occ_seq function",
+        "test_cu_views_split_occ_seq",
+        test_cu_views_split_occ_seq
+    });
+
+    suite.tests.emplace_back(new test {
+        "Test CU views' split function",
+        "test_cu_views_split",
+        test_cu_views_split
+    });
+
+    suite.tests.emplace_back(new test {
+        "Test CU's multi_searcher struct",
+        "test_cu_multi_searcher",
+        test_cu_multi_searcher
+    });
+
+    suite.tests.emplace_back(new test {
+        "Test CU's searcher struct",
+        "test_cu_searcher",
+        test_cu_searcher
+    });
+
+    suite.tests.emplace_back(new test {
+        "Test CU's byte_set struct",
+        "test_cu_byte_set",
+        test_cu_byte_set
+    });
+
+    suite.tests.emplace_back(new test {
+        "Test CU's jagged struct",
+        "test_cu_jagged",
+        test_cu_jagged
+    });
+
+    suite.tests.emplace_back(new test {
+        "Test CU's allocator support",
+        "test_cu_allocator",
+        test_cu_allocator
+    });
+
+    suite.tests.emplace_back(new test {
+        "Test CU's _into functions",
+        "test_cu_into",
+        test_cu_into
+    });
+
+    suite.tests.emplace_back(new test {
+        "Test CU's _inplace functions",
+        "test_cu_inplace",
+        test_cu_inplace
+    });
+
+    suite.tests.emplace_back(new test {
+        "Test CU's parallel execution-policy overloads",
+        "test_cu_parallel",
+        test_cu_parallel
+    });
+
+    suite.tests.emplace_back(new test {
+        "Test CU's stream_splitter",
+        "test_cu_stream_splitter",
+        test_cu_stream_splitter
+    });
+
+    suite.tests.emplace_back(new test {
+        "Test CU's size queries",
+        "test_cu_size_queries",
+        test_cu_size_queries
+    });
+
+    suite.tests.emplace_back(new test {
+        "Test CU operators' expressions",
+        "test_cu_expression",
+        test_cu_expression
+    });
+
     suite.tests.emplace_back(new test {
         "Test CU operators' operator+ (overload 1)",
         "test_cu_operator_plus_1",
@@ -852,12 +1918,60 @@ using namespace cu_operators;
         test_cu_containers_boundless_string_view
     });
 
+    suite.tests.emplace_back(new test {
+        "Test CU containers' boundless_ring struct.",
+        "test_cu_containers_boundless_ring",
+        test_cu_containers_boundless_ring
+    });
+
+    suite.tests.emplace_back(new test {
+        "Test CU containers' boundless_deque struct.",
+        "test_cu_containers_boundless_deque",
+        test_cu_containers_boundless_deque
+    });
+
+    suite.tests.emplace_back(new test {
+        "Test CU containers' enumerator names.",
+        "test_cu_containers_enum_names",
+        test_cu_containers_enum_names
+    });
+
     suite.tests.emplace_back(new test {
         "Test CU containers' enumerated_array struct.",
         "test_cu_containers_enumerated_array",
         test_cu_containers_enumerated_array
     });
 
+    suite.tests.emplace_back(new test {
+        "Test CU containers' enumerated_array_nd struct.",
+        "test_cu_containers_enumerated_array_nd",
+        test_cu_containers_enumerated_array_nd
+    });
+
+    suite.tests.emplace_back(new test {
+        "Test CU containers' enumerated_soa struct.",
+        "test_cu_containers_enumerated_soa",
+        test_cu_containers_enumerated_soa
+    });
+
+    suite.tests.emplace_back(new test {
+        "Test CU containers' enumerated_bitset struct.",
+        "test_cu_containers_enumerated_bitset",
+        test_cu_containers_enumerated_bitset
+    });
+
+    suite.tests.emplace_back(new test {
+        "Test CU containers' enumerated_optional_map struct.",
+        "test_cu_containers_enumerated_optional_map",
+        test_cu_containers_enumerated_optional_map
+    });
+
+    suite.tests.emplace_back(new test {
+        "Test CU containers' small_vector struct.",
+        "test_cu_containers_small_vector",
+        test_cu_containers_small_vector
+    });
+
     std::size_t errors = (std::size_t)-1;
     try
     {
@@ -42,6 +42,13 @@
  *    "Standard" (for "Auspicious") and "Small" (for "LIBRARY").
  */
 
+#include <format>
+#include <memory_resource>
+#include <numeric>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <string_view>
 #include <vector>
 
 #include "tester.hpp"
@@ -95,6 +102,25 @@
                 "Invalid element");
         }
 
+        // Non-literal types use a lazily initialized default
+        struct non_literal {
+            int value;
+            non_literal() : value(0) {}
+        };
+        static_assert(!cu::impl::constant_default_constructible<non_literal>);
+
+        const std::vector<non_literal> non_literals(1);
+        T_ASSERT(cu::boundless_access(non_literals, 1).value, 0,
+            "Invalid element");
+
+        // Temporaries are accessed by value
+        auto temporary = cu::boundless_access(std::vector { 1, 2 }, 1);
+        T_ASSERT(temporary, 2, "Invalid element");
+        T_ASSERT(cu::boundless_access(std::vector { 1, 2 }, 2), 0,
+            "Invalid element");
+        static_assert(!std::is_reference_v<decltype(cu::boundless_access(
+            std::vector { 1, 2 }, 0))>);
+
         for (std::size_t i = -values.size(); i != values.size(); i++)
         {
             cu::boundless_access(values, i) = i;
@@ -197,6 +223,24 @@
             T_ASSERT(value, expected,
                 "Invalid element");
         }
+
+        // Constant access refers to the elements instead of copying them
+        const cu::boundless_vector<std::string> strings = { "a", "b" };
+
+        const std::string &first    = strings[0];
+        const std::string &invalid  = strings.at(5);
+        const std::string &invalid2 = strings[7];
+
+        T_ASSERT((void *)&first, (void *)strings.data(),
+            "Element was copied");
+        T_ASSERT((void *)&invalid, (void *)&invalid2,
+            "Default constructed instance is not shared");
+        T_ASSERT(invalid.empty(), true,
+            "Invalid default constructed instance");
+
+        // Constant access of valid indices works in constant expressions
+        static constexpr cu::boundless_array<int, 3> constant = { 1, 2, 3 };
+        static_assert(constant[1] == 2);
     }
     catch (const std::exception &e)
     {
@@ -506,6 +550,276 @@
     T_END;
 }
 
+/**
+ *  @brief  Test CU containers' @c boundless_ring struct.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] auto test_cu_containers_boundless_ring() -> std::size_t
+{
+    T_BEGIN;
+
+    cu::boundless_ring<int, 4> ring;
+
+    try
+    {
+        for (int i = 1; i <= 6; i++)
+        {
+            ring.push_back(i);
+        }
+
+        // Oldest elements are overwritten when full
+        std::vector window = { 3, 4, 5, 6 };
+        T_ASSERT_CTR(ring, window);
+        T_ASSERT(ring.full(), true, "Ring is not full");
+        T_ASSERT(ring.front(), 3, "Invalid front");
+        T_ASSERT(ring.back(), 6, "Invalid back");
+
+        auto [first, second] = ring.segments();
+        T_ASSERT(first.size(), 2, "Invalid first segment");
+        T_ASSERT(second.size(), 2, "Invalid second segment");
+        T_ASSERT(first[0], 3, "Invalid first segment");
+        T_ASSERT(second[1], 6, "Invalid second segment");
+
+        // Pushing to the front overwrites the back
+        ring.push_front(2);
+        std::vector pushed_front = { 2, 3, 4, 5 };
+        T_ASSERT_CTR(ring, pushed_front);
+
+        ring.pop_front();
+        ring.pop_back();
+        std::vector popped = { 3, 4 };
+        T_ASSERT_CTR(ring, popped);
+
+        ring.pop_back(5);
+        ring.pop_front();
+        T_ASSERT(ring.empty(), true, "Ring is not empty");
+        T_ASSERT(ring.front(), 0, "Invalid default constructed instance");
+
+        // Only the last elements that fit are kept
+        std::vector batch = { 7, 8, 9, 10, 11, 12 };
+        ring.push_back(1);
+        ring.append_range(batch);
+        std::vector appended = { 9, 10, 11, 12 };
+        T_ASSERT_CTR(ring, appended);
+
+        auto linear = ring.linearize();
+        T_ASSERT_CTR(linear, appended);
+        T_ASSERT(ring.segments().second.empty(), true,
+            "Elements are not contiguous");
+
+        for (std::size_t i = ring.size(); i < ring.size() * 2; i++)
+        {
+            ring[i] = 42;
+
+            auto value    = ring[i];
+            auto expected = 0;
+
+            T_ASSERT(value, expected, "Invalid element");
+        }
+
+        const auto &constant = ring;
+
+        const int &element  = constant[0];
+        const int &invalid  = constant[7];
+        const int &invalid2 = constant.at(9);
+
+        T_ASSERT((void *)&element, (void *)ring.segments().first.data(),
+            "Element was copied");
+        T_ASSERT((void *)&invalid, (void *)&invalid2,
+            "Default constructed instance is not shared");
+
+        static_assert([]
+        {
+            cu::boundless_ring<int, 4> constant_ring;
+            constant_ring.push_back(5);
+
+            const auto &ring_ref = constant_ring;
+            return ring_ref.at(0);
+        }() == 5);
+    }
+    catch (const std::exception &e)
+    {
+        logln("Exception occurred in test_cu_containers_boundless_ring: {}",
+            e.what());
+    }
+    catch (...)
+    {
+        logln("Unknown exception occurred in "
+            "test_cu_containers_boundless_ring");
+    }
+
+    T_END;
+}
+
+/**
+ *  @brief  Test CU containers' @c boundless_deque struct.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] auto test_cu_containers_boundless_deque() -> std::size_t
+{
+    T_BEGIN;
+
+    cu::boundless_deque<std::string> deque;
+
+    try
+    {
+        deque.push_back("b");
+        deque.push_back("c");
+        deque.push_front("a");
+
+        std::vector<std::string> pushed = { "a", "b", "c" };
+        T_ASSERT_CTR(deque, pushed);
+
+        // Growing keeps the order of wrapped elements
+        std::vector<std::string> batch;
+        for (std::size_t i = 0; i < 100; i++)
+        {
+            batch.push_back(std::format("{}", i));
+        }
+        deque.append_range(batch);
+
+        T_ASSERT(deque.size(), 103, "Invalid size");
+        T_ASSERT(deque[2], "c", "Invalid element");
+        T_ASSERT(deque[3], "0", "Invalid element");
+        T_ASSERT(deque.back(), "99", "Invalid back");
+
+        // Pushing an element of the deque itself while growing
+        while (!deque.full())
+        {
+            deque.push_back("x");
+        }
+        deque.push_back(deque[0]);
+        T_ASSERT(deque.back(), "a", "Invalid back");
+
+        deque.pop_front(2);
+        T_ASSERT(deque.front(), "c", "Invalid front");
+        T_ASSERT(deque[1000], "", "Invalid element");
+
+        auto is_random_access = std::ranges::random_access_range<
+            cu::boundless_deque<int>>;
+        T_ASSERT(is_random_access, true, "Deque is not random access");
+
+        auto joined = std::string();
+        for (const auto &string : deque | std::views::take(3))
+        {
+            joined += string;
+        }
+        T_ASSERT(joined, "c01", "Invalid iteration");
+
+        deque.clear();
+        T_ASSERT(deque.empty(), true, "Deque is not empty");
+        T_ASSERT(deque.back(), "", "Invalid default constructed instance");
+    }
+    catch (const std::exception &e)
+    {
+        logln("Exception occurred in test_cu_containers_boundless_deque: {}",
+            e.what());
+    }
+    catch (...)
+    {
+        logln("Unknown exception occurred in "
+            "test_cu_containers_boundless_deque");
+    }
+
+    T_END;
+}
+
+/**
+ *  @brief  Enumerator with user supplied names.
+ */
+enum class named {
+    first,
+    second,
+    max
+};
+
+/**
+ *  @brief  User supplied names of @c named .
+ */
+template<>
+struct cu::enum_name_list<named> {
+
+    /**
+     *  @brief  The names.
+     */
+    static constexpr std::array<std::string_view, 2> names = { "one", "two" };
+};
+
+namespace {
+
+/**
+ *  @brief  Enumerator in an anonymous namespace, scoped differently by each
+ *          compiler.
+ */
+enum class hidden {
+    inner,
+    max
+};
+
+} // namespace
+
+/**
+ *  @brief  Test CU containers' enumerator names.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] auto test_cu_containers_enum_names() -> std::size_t
+{
+    T_BEGIN;
+
+    enum class fruit {
+        apple,
+        banana,
+        cherry,
+        max
+    };
+
+    try
+    {
+        static_assert(cu::enum_to_string(fruit::banana) == "banana");
+        static_assert(cu::enum_from_string<fruit>("cherry") == fruit::cherry);
+
+        for (auto name : { "apple", "banana", "cherry" })
+        {
+            auto value    = cu::enum_to_string(*cu::enum_from_string<fruit>(
+                name));
+            auto expected = std::string_view(name);
+
+            T_ASSERT(value, expected, "Invalid round trip");
+        }
+
+        auto missing = cu::enum_from_string<fruit>("max").has_value()
+                    || cu::enum_from_string<fruit>("banan").has_value()
+                    || cu::enum_from_string<fruit>("").has_value();
+        T_ASSERT(missing, false, "Invalid name was converted");
+        T_ASSERT(cu::enum_to_string(fruit::max), "", "Invalid name");
+
+        // Names are extracted from the anonymous namespace too
+        static_assert(cu::enum_to_string(hidden::inner) == "inner");
+        auto inner = cu::enum_from_string<hidden>("inner") == hidden::inner;
+        T_ASSERT(inner, true, "Invalid enumerator");
+
+        // User supplied names replace the extracted names
+        T_ASSERT(cu::enum_to_string(named::second), "two", "Invalid name");
+
+        auto converted = cu::enum_from_string<named>("one");
+        auto extracted = cu::enum_from_string<named>("first");
+        auto is_first  = converted == named::first;
+        T_ASSERT(is_first, true, "Invalid enumerator");
+        T_ASSERT(extracted.has_value(), false, "Extracted name was used");
+    }
+    catch (const std::exception &e)
+    {
+        logln("Exception occurred in test_cu_containers_enum_names: {}",
+            e.what());
+    }
+    catch (...)
+    {
+        logln("Unknown exception occurred in test_cu_containers_enum_names");
+    }
+
+    T_END;
+}
+
 /**
  *  @brief  Test CU containers' @c enumerated_array struct.
  *  @return  Number of errors.
@@ -571,3 +885,512 @@
 
     T_END;
 }
+
+/**
+ *  @brief  Test CU containers' @c enumerated_array_nd struct.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] auto test_cu_containers_enumerated_array_nd() -> std::size_t
+{
+    T_BEGIN;
+
+    enum class row {
+        zeroth,
+        first,
+        max
+    };
+
+    enum class column {
+        zeroth,
+        first,
+        second,
+        max
+    };
+
+    try
+    {
+        using table = cu::enumerated_array2d<int, row, column>;
+        static_assert(table::index(row::first, column::second) == 5);
+        static_assert(sizeof(table) == sizeof(int) * 6);
+
+        table costs = {};
+        for (std::size_t i = 0; i < costs.size(); i++)
+        {
+            costs.base::operator[] (i) = (int)i;
+        }
+
+        auto value = costs[row::first, column::zeroth];
+        T_ASSERT(value, 3, "Invalid element");
+
+        costs[row::zeroth, column::second] = 42;
+        T_ASSERT(costs.at(row::zeroth, column::second), 42, "Invalid element");
+
+        // Out of range inner enumerator throws even if the flat index fits
+        bool thrown = false;
+        try
+        {
+            (void)costs.at(row::zeroth, (column)4);
+        }
+        catch (const std::out_of_range &)
+        {
+            thrown = true;
+        }
+        T_ASSERT(thrown, true, "Out of range column did not throw");
+
+        cu::enumerated_array_nd<int, row, column, row> cube = {};
+        cube[row::first, column::second, row::first] = 7;
+        T_ASSERT(cube.back(), 7, "Invalid element");
+    }
+    catch (const std::exception &e)
+    {
+        logln("Exception occurred in test_cu_containers_enumerated_array_nd: "
+            "{}", e.what());
+    }
+    catch (...)
+    {
+        logln("Unknown exception occurred in "
+            "test_cu_containers_enumerated_array_nd");
+    }
+
+    T_END;
+}
+
+/**
+ *  @brief  Test CU containers' @c enumerated_soa struct.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] auto test_cu_containers_enumerated_soa() -> std::size_t
+{
+    T_BEGIN;
+
+    enum class unit {
+        zeroth,
+        first,
+        second,
+        max
+    };
+
+    try
+    {
+        using enum unit;
+
+        cu::enumerated_soa<unit, int, std::string> units;
+
+        units.get<0>(first)  = 10;
+        units.get<1>(first)  = "first";
+        units.get<0>(second) = 20;
+
+        auto [health, name] = units[first];
+        T_ASSERT(health, 10, "Invalid field");
+        T_ASSERT(name, "first", "Invalid field");
+
+        // Fields are returned by reference
+        health = 15;
+        T_ASSERT(units.get<0>(first), 15, "Field was copied");
+
+        // Each field is contiguous
+        const auto &healths = units.field<0>();
+        auto total = std::accumulate(healths.begin(), healths.end(), 0);
+        T_ASSERT(total, 35, "Invalid field array");
+        T_ASSERT(units.size(), 3, "Invalid size");
+    }
+    catch (const std::exception &e)
+    {
+        logln("Exception occurred in test_cu_containers_enumerated_soa: {}",
+            e.what());
+    }
+    catch (...)
+    {
+        logln("Unknown exception occurred in "
+            "test_cu_containers_enumerated_soa");
+    }
+
+    T_END;
+}
+
+/**
+ *  @brief  Test CU containers' @c enumerated_bitset struct.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] auto test_cu_containers_enumerated_bitset() -> std::size_t
+{
+    T_BEGIN;
+
+    enum class flag {
+        zeroth,
+        first,
+        second,
+        third,
+        max = 70
+    };
+
+    try
+    {
+        using enum flag;
+
+        constexpr cu::enumerated_bitset<flag> constant = { first, third };
+        static_assert(constant.test(third) && !constant.test(second));
+        static_assert(sizeof(cu::enumerated_bitset<flag>) == 16);
+
+        cu::enumerated_bitset<flag> flags = { zeroth, third };
+        flags.set((flag)69);
+
+        T_ASSERT(flags.count(), 3, "Invalid count");
+        T_ASSERT(flags[third], true, "Flag is not set");
+        T_ASSERT(flags[second], false, "Flag is set");
+
+        std::vector<std::size_t> set;
+        for (auto e : flags)
+        {
+            set.push_back((std::size_t)e);
+        }
+        std::vector<std::size_t> expected = { 0, 3, 69 };
+        T_ASSERT_CTR(set, expected);
+
+        auto both   = flags & constant;
+        auto either = flags | constant;
+        auto one    = flags ^ constant;
+        T_ASSERT(both.count(), 1, "Invalid intersection");
+        T_ASSERT(either.count(), 4, "Invalid union");
+        T_ASSERT(one.count(), 3, "Invalid symmetric difference");
+
+        // Complement does not set bits past the last enumerator
+        auto complement = ~flags;
+        auto everything = complement | flags;
+        T_ASSERT(complement.count(), 67, "Invalid complement");
+        T_ASSERT(everything.all(), true, "Invalid complement");
+
+        flags.reset(zeroth).flip(third).flip((flag)69);
+        T_ASSERT(flags.none(), true, "Flags are set");
+        auto empty = flags == cu::enumerated_bitset<flag>();
+        T_ASSERT(empty, true, "Invalid comparison");
+    }
+    catch (const std::exception &e)
+    {
+        logln("Exception occurred in test_cu_containers_enumerated_bitset: {}",
+            e.what());
+    }
+    catch (...)
+    {
+        logln("Unknown exception occurred in "
+            "test_cu_containers_enumerated_bitset");
+    }
+
+    T_END;
+}
+
+/**
+ *  @brief  Test CU containers' @c enumerated_optional_map struct.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] auto test_cu_containers_enumerated_optional_map() -> std::size_t
+{
+    T_BEGIN;
+
+    enum class key {
+        zeroth,
+        first,
+        second,
+        third,
+        max
+    };
+
+    try
+    {
+        using enum key;
+
+        cu::enumerated_optional_map<std::string, key> map = {
+            { third, "three" },
+            { first, "one" }
+        };
+
+        T_ASSERT(map.size(), 2, "Invalid size");
+        T_ASSERT(map.contains(first), true, "Key is not present");
+        T_ASSERT(map.contains(second), false, "Key is present");
+        T_ASSERT(map.at(third), "three", "Invalid element");
+
+        auto [it, inserted] = map.insert(first, "uno");
+        T_ASSERT(inserted, false, "Present key was inserted");
+        T_ASSERT(it->second, "one", "Present key was replaced");
+
+        auto assigned = map.insert_or_assign(first, "uno").second;
+        T_ASSERT(assigned, false, "Present key was inserted");
+        T_ASSERT(map.at(first), "uno", "Present key was not replaced");
+
+        map[zeroth] += "zero";
+        T_ASSERT(map.at(zeroth), "zero", "Invalid element");
+
+        // Iteration visits the present keys only, in order
+        std::vector<std::size_t> keys;
+        std::string              joined;
+        for (auto [k, value] : map)
+        {
+            keys.push_back((std::size_t)k);
+            joined += value;
+        }
+        std::vector<std::size_t> expected = { 0, 1, 3 };
+        T_ASSERT_CTR(keys, expected);
+        T_ASSERT(joined, "zerounothree", "Invalid iteration");
+
+        std::vector<std::size_t> reversed;
+        for (auto r = map.crbegin(); r != map.crend(); r++)
+        {
+            reversed.push_back((std::size_t)r->first);
+        }
+        std::vector<std::size_t> expected_reversed = { 3, 1, 0 };
+        T_ASSERT_CTR(reversed, expected_reversed);
+
+        T_ASSERT(map.erase(first), 1, "Key was not erased");
+        T_ASSERT(map.erase(first), 0, "Absent key was erased");
+        auto found = map.find(first) != map.end();
+        T_ASSERT(found, false, "Erased key was found");
+
+        auto throws = false;
+        try
+        {
+            (void)map.at(second);
+        }
+        catch (const std::out_of_range &)
+        {
+            throws = true;
+        }
+        T_ASSERT(throws, true, "Absent key did not throw");
+
+        auto copy  = map;
+        auto equal = copy == map;
+        T_ASSERT(equal, true, "Copy is not equal");
+
+        map.clear();
+        T_ASSERT(map.empty(), true, "Map is not empty");
+        equal = copy == map;
+        T_ASSERT(equal, false, "Cleared map is equal");
+    }
+    catch (const std::exception &e)
+    {
+        logln(
+            "Exception occurred in test_cu_containers_enumerated_optional_map: "
+            "{}",
+            e.what());
+    }
+    catch (...)
+    {
+        logln("Unknown exception occurred in "
+            "test_cu_containers_enumerated_optional_map");
+    }
+
+    T_END;
+}
+
+/**
+ *  @brief  Stateful allocator that propagates on copy and move assignment.
+ *  @tparam  T  The type of element.
+ */
+template<typename T>
+struct tagged_allocator {
+
+    /**
+     *  @brief  Type of element.
+     */
+    using value_type = T;
+
+    /**
+     *  @brief  Propagate on copy assignment.
+     */
+    using propagate_on_container_copy_assignment = std::true_type;
+
+    /**
+     *  @brief  Propagate on move assignment.
+     */
+    using propagate_on_container_move_assignment = std::true_type;
+
+    /**
+     *  @brief  The tag, allocators with different tags are not equal.
+     */
+    int tag = 0;
+
+    tagged_allocator() = default;
+
+    explicit tagged_allocator(int id) : tag(id) {}
+
+    template<typename U>
+    tagged_allocator(const tagged_allocator<U> &other) : tag(other.tag) {}
+
+    [[nodiscard]] auto allocate(std::size_t n) -> T *
+    {
+        return std::allocator<T>().allocate(n);
+    }
+
+    auto deallocate(T *pointer, std::size_t n) -> void
+    {
+        std::allocator<T>().deallocate(pointer, n);
+    }
+
+    [[nodiscard]] auto operator== (const tagged_allocator &other) const
+    -> bool = default;
+};
+
+/**
+ *  @brief  Test CU containers' @c small_vector struct.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] auto test_cu_containers_small_vector() -> std::size_t
+{
+    T_BEGIN;
+
+    try
+    {
+        using small = cu::small_vector<int, 4>;
+
+        static_assert(cu::cu_compatible<small>);
+        static_assert(cu::boundless_accessible<small>);
+
+        small vector = { 1, 2, 3 };
+        T_ASSERT(vector.is_inline(), true, "Elements are not inline");
+
+        vector.push_back(4);
+        vector.push_back(vector[0]);
+        std::vector expected_spilled = { 1, 2, 3, 4, 1 };
+        T_ASSERT(vector.is_inline(), false, "Elements are not on the heap");
+        T_ASSERT_CTR(vector, expected_spilled);
+
+        vector.insert(vector.begin() + 1, { 7, 8 });
+        vector.erase(vector.begin() + 4);
+        std::vector expected_inserted = { 1, 7, 8, 2, 4, 1 };
+        T_ASSERT_CTR(vector, expected_inserted);
+
+        // Moving takes over the heap storage
+        auto  data  = vector.data();
+        small moved = std::move(vector);
+        T_ASSERT((void *)moved.data(), (void *)data, "Heap storage was copied");
+        T_ASSERT(vector.size(), 0, "Moved vector is not empty");
+
+        small copied = moved;
+        copied.resize(2);
+        std::vector expected_resized = { 1, 7 };
+        T_ASSERT_CTR(copied, expected_resized);
+        T_ASSERT(cu::boundless_access(copied, 5), 0,
+            "Invalid boundless access");
+
+        std::vector container = { 1, 2, 3, 1, 2, 3, 4 };
+        std::vector pattern   = { 1, 2 };
+        std::vector values    = { 3 };
+
+        auto filtered = cu::filter_out_seq<small>(container, pattern);
+        std::vector expected_filtered = { 3, 3, 4 };
+        T_ASSERT(filtered.is_inline(), true, "Elements are not inline");
+        T_ASSERT_CTR(filtered, expected_filtered);
+
+        auto filtered_occ = cu::filter_out_occ<small>(container, values);
+        auto expected_occ = cu::filter_out_occ(container, values);
+        T_ASSERT_CTR(filtered_occ, expected_occ);
+
+        auto repeated = cu::repeat<small>(pattern, 1.5);
+        std::vector expected_repeated = { 1, 2, 1 };
+        T_ASSERT_CTR(repeated, expected_repeated);
+
+        auto combined = cu::combine<small>(pattern, values);
+        std::vector expected_combined = { 1, 2, 3 };
+        T_ASSERT_CTR(combined, expected_combined);
+
+        auto split = cu::split_occ<std::vector<small>>(container, values);
+        auto expected_split = cu::split_occ(container, values);
+        T_ASSERT_NEST_CTR(split, expected_split);
+
+        // Element that is copied instead of moved, and throws on the third copy
+        struct throwing {
+            int  value  = 0;
+            int *copies = nullptr;
+
+            throwing(int number, int *counter)
+                : value(number), copies(counter)
+            {}
+
+            throwing(const throwing &other)
+                : value(other.value), copies(other.copies)
+            {
+                if (++*copies == 3) throw std::runtime_error("Copy failed");
+            }
+        };
+
+        int copy_count = 0;
+        cu::small_vector<throwing, 4> spilling = {};
+        for (int i = 0; i < 4; i++) spilling.emplace_back(i, &copy_count);
+
+        auto thrown = false;
+        try
+        {
+            spilling.reserve(16);
+        }
+        catch (const std::runtime_error &)
+        {
+            thrown = true;
+        }
+
+        // A failed reallocation leaves the elements where they were
+        T_ASSERT(thrown, true, "Copy did not throw");
+        T_ASSERT(spilling.is_inline(), true, "Elements are not inline");
+        T_ASSERT(spilling.size(), 4, "Elements were lost");
+        T_ASSERT(spilling.back().value, 3, "Elements were lost");
+
+        cu::small_vector<throwing, 4> spilled = {};
+        spilled.reserve(8);
+        for (int i = 0; i < 6; i++) spilled.emplace_back(i, &copy_count);
+
+        // A copy that spills and then throws must free its heap storage
+        copy_count    = 0;
+        auto rethrown = false;
+        try
+        {
+            cu::small_vector<throwing, 4> spilled_copy = spilled;
+        }
+        catch (const std::runtime_error &)
+        {
+            rethrown = true;
+        }
+
+        T_ASSERT(rethrown, true, "Spilling copy did not throw");
+        T_ASSERT(spilled.size(), 6, "Source elements were lost");
+
+        // Allocators that propagate replace the target's allocator
+        using tagged = cu::small_vector<int, 2, tagged_allocator<int>>;
+
+        tagged source({ 1, 2, 3 }, tagged_allocator<int>(1));
+        tagged target(tagged_allocator<int>(2));
+        target = source;
+        T_ASSERT(target.get_allocator().tag, 1, "Allocator was not copied");
+        T_ASSERT_CTR(target, source);
+
+        tagged moved_from({ 4, 5, 6 }, tagged_allocator<int>(3));
+        auto heap = moved_from.data();
+
+        target = std::move(moved_from);
+        T_ASSERT(target.get_allocator().tag, 3, "Allocator was not moved");
+        T_ASSERT((void *)target.data(), (void *)heap,
+            "Heap storage was copied");
+
+        // Allocators that don't propagate keep the target's allocator
+        std::pmr::monotonic_buffer_resource resource_a;
+        std::pmr::monotonic_buffer_resource resource_b;
+        using pmr_small = cu::small_vector<int, 2,
+            std::pmr::polymorphic_allocator<int>>;
+
+        pmr_small pmr_source({ 1, 2, 3 }, &resource_a);
+        pmr_small pmr_target(&resource_b);
+        pmr_target = std::move(pmr_source);
+        T_ASSERT((void *)pmr_target.get_allocator().resource(),
+            (void *)&resource_b, "Allocator was propagated");
+        T_ASSERT(pmr_target.size(), 3, "Elements were lost");
+    }
+    catch (const std::exception &e)
+    {
+        logln("Exception occurred in test_cu_containers_small_vector: {}",
+            e.what());
+    }
+    catch (...)
+    {
+        logln("Unknown exception occurred in "
+            "test_cu_containers_small_vector");
+    }
+
+    T_END;
+}
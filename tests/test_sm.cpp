@@ -44,9 +44,13 @@
 
 #include <cstddef>
 #include <format>
+#include <iterator>
 #include <limits>
+#include <locale>
+#include <map>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 
 #include "tester.hpp"
 
@@ -110,6 +114,24 @@ using namespace sm_operators;
 
     T_ASSERT_SIZE(wrapped_2, expected_2);
 
+    // Lines as views into the string
+    auto views = sm::word_wrap_views(long_string, 40);
+    T_ASSERT_CTR(views, expected_1);
+    T_ASSERT((void *)views.front().data(), (void *)long_string.data(),
+        "Line was copied");
+
+    // Lines passed to a function with compiled delimiters
+    sm::char_set delims(" \t");
+    std::vector<std::string> lines = {};
+    sm::word_wrap_each(long_string, 40,
+        [&](std::string_view line) { lines.emplace_back(line); }, true, delims);
+    T_ASSERT_CTR(lines, expected_2);
+
+    // Long word at the end without any delimiter after it
+    auto last_word = sm::word_wrap_views("ab cdefgh", 3);
+    std::vector expected_3 = { "ab"sv, "cdefgh"sv };
+    T_ASSERT_CTR(last_word, expected_3);
+
     T_END;
 }
 
@@ -179,6 +201,54 @@ using namespace sm_operators;
     T_END;
 }
 
+/**
+ *  @brief  Test SM's @c char_set struct.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] static auto test_sm_char_set() -> std::size_t
+{
+    T_BEGIN;
+
+    static constexpr sm::char_set punctuation(",;");
+    static_assert(punctuation.contains(';'));
+    static_assert(!punctuation.contains(' '));
+    static_assert(sm::trim("--Ayo--", sm::char_set("-")) == "Ayo");
+    static_assert(sm::char_set(" \t") == sm::char_set("\t "));
+
+    std::string string = "  a,b;;c ";
+    logln("string: {}", string);
+
+    auto first     = punctuation.find_first_of(string);
+    auto first_not = sm::whitespace.find_first_not_of(string);
+    auto last      = punctuation.find_last_of(string);
+    auto last_not  = sm::whitespace.find_last_not_of(string);
+    T_ASSERT(first, 3, "Invalid position");
+    T_ASSERT(first_not, 2, "Invalid position");
+    T_ASSERT(last, 6, "Invalid position");
+    T_ASSERT(last_not, 7, "Invalid position");
+
+    // Same results as with the delimiters as string
+    auto trimmed = sm::trim(string, sm::whitespace);
+    T_ASSERT(trimmed, sm::trim(string, " "), "Invalid result");
+
+    auto pieces   = sm::split_occ(trimmed, punctuation);
+    auto expected = sm::split_occ(trimmed, ",;");
+    T_ASSERT_CTR(pieces, expected);
+
+    auto filtered = sm::filter_out_occ(string, punctuation);
+    T_ASSERT(filtered, "  abc ", "Invalid result");
+
+    std::string buffer = "> ";
+    sm::filter_out_occ_into(string, punctuation, buffer);
+    T_ASSERT(buffer, ">   abc ", "Invalid result");
+
+    auto removed = sm::filter_out_occ_inplace(string, punctuation);
+    T_ASSERT(removed, 3, "Invalid number of removed characters");
+    T_ASSERT(string, "  abc ", "Invalid result");
+
+    T_END;
+}
+
 /**
  *  @brief  Test SM's @c to_upper function (overload 1).
  *  @return  Number of errors.
@@ -267,6 +337,52 @@ using namespace sm_operators;
     T_END;
 }
 
+/**
+ *  @brief  Test SM's ASCII case conversion of every byte.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] static auto test_sm_case_conversion() -> std::size_t
+{
+    T_BEGIN;
+
+    static_assert(sm::to_upper('q') == 'Q' && sm::to_lower('Q') == 'q');
+    static_assert(sm::to_lower("HeLLo, World!") == "hello, world!");
+
+    // Every byte, twice, so the vector kernels and the tail are both used
+    std::string string   = {};
+    std::string expected = {};
+    for (std::size_t i = 0; i < 512 + 7; i++)
+    {
+        auto c = (char)(i % 256);
+        string   += c;
+        expected += c >= 'A' && c <= 'Z' ? (char)(c + 32) : c;
+    }
+
+    auto lower = sm::to_lower(string);
+    T_ASSERT_CTR(lower, expected);
+
+    auto upper = sm::to_upper(lower);
+    auto back  = sm::to_lower(upper);
+    T_ASSERT_CTR(back, expected);
+
+    auto inplace = string;
+    sm::to_lower_inplace(inplace);
+    T_ASSERT_CTR(inplace, expected);
+
+    std::string into = "prefix:";
+    sm::to_lower_into(string, into);
+    T_ASSERT(into.substr(7), expected, "Invalid conversion");
+
+    std::string inserted = {};
+    sm::to_upper_into("header-key", std::back_inserter(inserted));
+    T_ASSERT(inserted, "HEADER-KEY", "Invalid conversion");
+
+    auto localized = sm::to_upper("LaTeX", std::locale::classic());
+    T_ASSERT(localized, "LATEX", "Invalid conversion");
+
+    T_END;
+}
+
 /**
  *  @brief  Test SM's @c is_equal_ins function (overload 1).
  *  @return  Number of errors.
@@ -325,6 +441,314 @@ using namespace sm_operators;
     T_END;
 }
 
+/**
+ *  @brief  Test SM's case insensitive compare, hash and functors.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] static auto test_sm_ins() -> std::size_t
+{
+    T_BEGIN;
+
+    static_assert(sm::is_equal_ins("LaTeX", "lAtEx"));
+    static_assert(!sm::is_equal_ins("LaTeX", "LaTeX2"));
+    static_assert(std::is_same_v<decltype(sm::compare_ins("a", "A")),
+        std::weak_ordering>);
+
+    auto less    = sm::compare_ins("apple", "BANANA") < 0;
+    auto equal   = sm::compare_ins("Apple", "aPPLE") == 0;
+    auto shorter = sm::compare_ins("APP", "apple") < 0;
+    T_ASSERT(less, true, "Invalid ordering");
+    T_ASSERT(equal, true, "Invalid ordering");
+    T_ASSERT(shorter, true, "Invalid ordering");
+
+    auto hash_a = sm::hash_ins("Content-Type");
+    auto hash_b = sm::hash_ins("content-type");
+    T_ASSERT(hash_a, hash_b, "Hashes are different");
+
+    // Heterogeneous lookup with string views, no temporary strings
+    std::unordered_map<std::string, int, sm::ci_hash, sm::ci_equal> commands
+        = { { "Help", 1 }, { "Quit", 2 } };
+
+    auto found = commands.find("QUIT"sv);
+    auto value = found == commands.end() ? 0 : found->second;
+    T_ASSERT(value, 2, "Command was not found");
+
+    std::map<std::string, int, sm::ci_less> ordered = { { "b", 1 } };
+    auto contains = ordered.contains("B"sv);
+    T_ASSERT(contains, true, "Key was not found");
+
+    T_END;
+}
+
+/**
+ *  @brief  Test SM's @c _into functions.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] static auto test_sm_into() -> std::size_t
+{
+    T_BEGIN;
+
+    std::string string = "a, b,, c";
+    std::vector<std::string> patterns = { ", ", "," };
+
+    std::string buffer = {};
+    buffer.reserve(64);
+    auto data = buffer.data();
+
+    logln("string: {}", string);
+
+    buffer = "> ";
+    sm::filter_out_seq_into(string, ", ", buffer);
+    T_ASSERT(buffer, "> ab,c", "Invalid result");
+
+    buffer = "> ";
+    sm::filter_out_occ_into(string, ", ", buffer);
+    T_ASSERT(buffer, "> abc", "Invalid result");
+
+    buffer = "> ";
+    sm::filter_out_occ_seq_into(string, patterns, buffer);
+    T_ASSERT(buffer, "> abc", "Invalid result");
+
+    // Compiled patterns are reused across calls
+    cu::searcher<std::string_view> comma(std::string_view(", "));
+    cu::multi_searcher<std::string> commas(patterns);
+
+    buffer = "> ";
+    sm::filter_out_seq_into(string, comma, buffer);
+    T_ASSERT(buffer, "> ab,c", "Invalid result");
+
+    buffer = "> ";
+    sm::filter_out_occ_seq_into(string, commas, buffer);
+    T_ASSERT(buffer, "> abc", "Invalid result");
+
+    buffer = "> ";
+    sm::filter_out_into(string, ',', buffer);
+    T_ASSERT(buffer, "> a b c", "Invalid result");
+
+    buffer = "> ";
+    sm::repeat_into("ab", 2.5, buffer);
+    T_ASSERT(buffer, "> ababa", "Invalid result");
+
+    T_ASSERT((void *)buffer.data(), (void *)data, "Buffer was reallocated");
+
+    T_END;
+}
+
+/**
+ *  @brief  Test SM's @c _inplace functions.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] static auto test_sm_inplace() -> std::size_t
+{
+    T_BEGIN;
+
+    std::string string = "a, b,, c";
+    std::vector<std::string> patterns = { ", ", "," };
+
+    logln("string: {}", string);
+
+    std::string buffer = string;
+    sm::filter_out_seq_inplace(buffer, ", ");
+    T_ASSERT(buffer, "ab,c", "Invalid result");
+
+    buffer = string;
+    sm::filter_out_occ_inplace(buffer, ", ");
+    T_ASSERT(buffer, "abc", "Invalid result");
+
+    buffer = string;
+    sm::filter_out_occ_seq_inplace(buffer, patterns);
+    T_ASSERT(buffer, "abc", "Invalid result");
+
+    buffer = string;
+    sm::filter_out_inplace(buffer, ',');
+    T_ASSERT(buffer, "a b c", "Invalid result");
+
+    buffer = "ab";
+    sm::repeat_inplace(buffer, 2.5);
+    T_ASSERT(buffer, "ababa", "Invalid result");
+
+    T_END;
+}
+
+/**
+ *  @brief  Test SM's @c stream_splitter .
+ *  @return  Number of errors.
+ */
+[[nodiscard]] static auto test_sm_stream_splitter() -> std::size_t
+{
+    T_BEGIN;
+
+    std::string_view stream = "GET / HTTP/1.1\r\nHost: a\r\n\r\n";
+    std::vector<std::string> expected = { "GET / HTTP/1.1", "Host: a", "",
+        "" };
+
+    logln("stream: {}", stream);
+
+    for (std::size_t size = 1; size <= stream.size(); size++)
+    {
+        auto splitter = sm::stream_split_seq("\r\n");
+
+        std::vector<std::string> lines = {};
+        auto push = [&](std::string_view line) { lines.emplace_back(line); };
+
+        for (std::size_t i = 0; i < stream.size(); i += size)
+        {
+            splitter.feed(stream.substr(i, size), push);
+        }
+        splitter.finish(push);
+
+        T_ASSERT_CTR(lines, expected);
+    }
+
+    auto splitter = sm::stream_split_occ(" ,");
+    std::vector<std::string> words = {};
+    auto push = [&](std::string_view word) { words.emplace_back(word); };
+    std::vector<std::string> expected_words = { "a", "bc", "", "d" };
+
+    splitter.feed("a b", push);
+    splitter.feed("c, d", push);
+    splitter.finish(push);
+    T_ASSERT_CTR(words, expected_words);
+
+    // The pattern is copied, the temporary string does not outlive it
+    auto csv = sm::stream_split_seq(std::string(","));
+    std::vector<std::string> fields = {};
+    auto push_field = [&](std::string_view field)
+    {
+        fields.emplace_back(field);
+    };
+    std::vector<std::string> expected_fields = { "a", "bc", "", "d" };
+
+    csv.feed("a,b", push_field);
+    csv.feed("c,,d", push_field);
+    csv.finish(push_field);
+    T_ASSERT_CTR(fields, expected_fields);
+
+    T_END;
+}
+
+/**
+ *  @brief  Test SM's lazy splits returning views into the string.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] static auto test_sm_views() -> std::size_t
+{
+    T_BEGIN;
+
+    std::string line = "a,bc,,d";
+    std::vector<std::string_view> expected = { "a", "bc", "", "d" };
+
+    logln("line: {}", line);
+
+    auto pieces = sm::views::split(line, ',')
+                | std::ranges::to<std::vector<std::string_view>>();
+    T_ASSERT_CTR(pieces, expected);
+
+    // Pieces point into the string instead of copying it
+    T_ASSERT((void *)pieces[1].data(), (void *)(line.data() + 2),
+        "Piece was copied");
+
+    auto occ = sm::views::split_occ("a b,c", " ,")
+             | std::ranges::to<std::vector<std::string_view>>();
+    std::vector<std::string_view> expected_occ = { "a", "b", "c" };
+    T_ASSERT_CTR(occ, expected_occ);
+
+    auto seq = sm::views::split_seq("a::b::", "::")
+             | std::ranges::to<std::vector<std::string_view>>();
+    std::vector<std::string_view> expected_seq = { "a", "b", "" };
+    T_ASSERT_CTR(seq, expected_seq);
+
+    std::vector<std::string> patterns = { "--", "=" };
+    auto occ_seq = sm::views::split_occ_seq("a--b=c", patterns)
+                 | std::ranges::to<std::vector<std::string_view>>();
+    T_ASSERT_CTR(occ_seq, expected_occ);
+
+    T_ASSERT_CTR(sm::split(line, ','), expected);
+
+    T_END;
+}
+
+/**
+ *  @brief  Test SM's compile-time functions with @c fixed_string .
+ *  @return  Number of errors.
+ */
+[[nodiscard]] static auto test_sm_fixed_string() -> std::size_t
+{
+    T_BEGIN;
+
+    constexpr auto options  = sm::split_seq<"--help, --version, -v", ", ">();
+    constexpr auto keywords = sm::split_occ<"if else;for", " ;">();
+    constexpr auto fields   = sm::split<"a,,b,", ','>();
+    constexpr auto trimmed  = sm::filter_out_seq<"a--b--c", "--">();
+    constexpr auto digits   = sm::filter_out_occ<"1-2 3", " -">();
+    constexpr auto letters  = sm::filter_out<"a.b.c", '.'>();
+    constexpr auto line     = sm::repeat<"=-", 2.5>();
+
+    static_assert(options.size() == 3);
+    static_assert(trimmed.view() == "abc");
+
+    std::vector<std::string_view> expected_options  = { "--help",
+        "--version", "-v" };
+    std::vector<std::string_view> expected_keywords = { "if", "else", "for" };
+    std::vector<std::string_view> expected_fields   = { "a", "", "b", "" };
+
+    T_ASSERT_CTR(options, expected_options);
+    T_ASSERT_CTR(keywords, expected_keywords);
+    T_ASSERT_CTR(fields, expected_fields);
+    T_ASSERT(trimmed.view(), "abc", "Invalid result");
+    T_ASSERT(digits.view(), "123", "Invalid result");
+    T_ASSERT(letters.view(), "abc", "Invalid result");
+    T_ASSERT(line.view(), "=-=-=", "Invalid result");
+
+    T_END;
+}
+
+/**
+ *  @brief  Test SM operators' expressions.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] static auto test_sm_expression() -> std::size_t
+{
+    T_BEGIN;
+
+    std::string space = " ";
+    std::string tilde = "~";
+    std::string ab    = "ab";
+    std::string list  = "a,b";
+
+    auto marker = sm::lazy(space) * 2 + "^" + sm::lazy(tilde) * 3;
+    T_ASSERT(marker.size(), 6, "Invalid expression size");
+
+    std::string evaluated = marker;
+    logln("marker: {}", evaluated);
+    T_ASSERT(evaluated, "  ^~~~", "Invalid result");
+
+    // Formatting writes the expression without evaluating it
+    T_ASSERT(std::format("[{}]", marker), "[  ^~~~]", "Invalid result");
+
+    std::string prefixed = "> " + sm::lazy(ab) * 1.5 + '!';
+    T_ASSERT(prefixed, "> aba!", "Invalid result");
+
+    std::string filtered = sm::lazy(ab) * 3 - "ba";
+    T_ASSERT(filtered, "ab", "Invalid result");
+
+    std::vector<std::string> expected_split = { "a", "ba", "b" };
+
+    auto split = sm::lazy(list) * 2 / ',';
+    T_ASSERT_CTR(split, expected_split);
+
+    // Temporaries are owned by the expression
+    auto owned = sm::lazy(std::string("Spam. ")) * 2;
+    T_ASSERT(owned.evaluate(), "Spam. Spam. ", "Invalid result");
+
+    // Without sm::lazy, repeated strings are plain strings
+    auto plain = std::string("Spam. ") * 2;
+    T_ASSERT(plain.c_str()[6], 'S', "Invalid result");
+    T_ASSERT(sm::trim(std::string(" ") * 3 + "ab"), "ab", "Invalid result");
+
+    T_END;
+}
+
 /**
  *  @brief  Test SM operators' @c operator- (overload 1).
  *  @return  Number of errors.
@@ -547,6 +971,12 @@ using namespace sm_operators;
         test_sm_trim
     });
 
+    suite.tests.emplace_back(new test {
+        "Test SM's char_set struct",
+        "test_sm_char_set",
+        test_sm_char_set
+    });
+
     suite.tests.emplace_back(new test {
         "Test SM's trim_to_upper function (overload 1)",
         "test_sm_to_upper_1",
@@ -571,6 +1001,12 @@ using namespace sm_operators;
         test_sm_to_lower_2
     });
 
+    suite.tests.emplace_back(new test {
+        "Test SM's ASCII case conversion",
+        "test_sm_case_conversion",
+        test_sm_case_conversion
+    });
+
     suite.tests.emplace_back(new test {
         "Test SM's is_equal_ins function (overload 1)",
         "test_sm_is_equal_ins_1",
@@ -583,6 +1019,48 @@ using namespace sm_operators;
         test_sm_is_equal_ins_2
     });
 
+    suite.tests.emplace_back(new test {
+        "Test SM's case insensitive helpers",
+        "test_sm_ins",
+        test_sm_ins
+    });
+
+    suite.tests.emplace_back(new test {
+        "Test SM's _into functions",
+        "test_sm_into",
+        test_sm_into
+    });
+
+    suite.tests.emplace_back(new test {
+        "Test SM's _inplace functions",
+        "test_sm_inplace",
+        test_sm_inplace
+    });
+
+    suite.tests.emplace_back(new test {
+        "Test SM's stream_splitter",
+        "test_sm_stream_splitter",
+        test_sm_stream_splitter
+    });
+
+    suite.tests.emplace_back(new test {
+        "Test SM's views",
+        "test_sm_views",
+        test_sm_views
+    });
+
+    suite.tests.emplace_back(new test {
+        "Test SM's compile-time functions",
+        "test_sm_fixed_string",
+        test_sm_fixed_string
+    });
+
+    suite.tests.emplace_back(new test {
+        "Test SM operators' expressions",
+        "test_sm_expression",
+        test_sm_expression
+    });
+
     suite.tests.emplace_back(new test {
         "Test SM operators' operator- (overload 1)",
         "test_sm_operator_minus_1",